@@ -0,0 +1,144 @@
+//
+// Batched keyframe evaluation, lives alongside imgui_neo_sequencer
+//
+
+#include "imgui_neo_evaluator.h"
+#include "imgui_internal.h"
+
+#include <cstring>
+
+// Amount of keys cursor is moved linearly before falling back to binary search
+static const uint32_t cursorLinearSteps = 4;
+
+ImGuiNeoEvaluator::ImGuiNeoEvaluator()
+{
+    ChannelStarts.push_back(0);
+}
+
+int ImGuiNeoEvaluator::AddChannel(const int32_t* frames, const float* values, const ImU8* interpolations, uint32_t count)
+{
+    const int start = KeyFrames.Size;
+    KeyFrames.resize(start + (int) count);
+    KeyValues.resize(start + (int) count);
+    KeyInterpolations.resize(start + (int) count);
+
+    if (count > 0)
+    {
+        memcpy(KeyFrames.Data + start, frames, count * sizeof(int32_t));
+        memcpy(KeyValues.Data + start, values, count * sizeof(float));
+        if (interpolations)
+            memcpy(KeyInterpolations.Data + start, interpolations, count * sizeof(ImU8));
+        else
+            memset(KeyInterpolations.Data + start, ImGuiNeoInterpolation_Linear, count * sizeof(ImU8));
+    }
+
+    for (uint32_t i = 1; i < count; i++)
+        IM_ASSERT(frames[i - 1] <= frames[i] && "Channel keys must be sorted by frame!");
+
+    ChannelStarts.push_back((uint32_t) KeyFrames.Size);
+    Cursors.push_back((uint32_t) start);
+
+    return GetChannelCount() - 1;
+}
+
+void ImGuiNeoEvaluator::Clear()
+{
+    KeyFrames.resize(0);
+    KeyValues.resize(0);
+    KeyInterpolations.resize(0);
+    ChannelStarts.resize(1);
+    Cursors.resize(0);
+}
+
+// Index of last key in [begin, end) with frame <= value, begin if there is none
+static uint32_t findKey(const int32_t* frames, uint32_t begin, uint32_t end, double value)
+{
+    uint32_t lo = begin + 1, hi = end;
+    while (lo < hi)
+    {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        if ((double) frames[mid] <= value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo - 1;
+}
+
+const float* ImGuiNeoEvaluator::Evaluate(double frame)
+{
+    const int channelCount = GetChannelCount();
+
+    Results.resize(channelCount);
+    SegmentFrom.resize(channelCount);
+    SegmentTo.resize(channelCount);
+    SegmentT.resize(channelCount);
+    SegmentSmooth.resize(channelCount);
+
+    const int32_t* frames = KeyFrames.Data;
+    const float* values = KeyValues.Data;
+
+    // Gather pass, moves cursors and collects segment every channel is in
+    for (int c = 0; c < channelCount; c++)
+    {
+        const uint32_t begin = ChannelStarts[c];
+        const uint32_t end = ChannelStarts[c + 1];
+
+        if (begin == end)
+        {
+            SegmentFrom[c] = SegmentTo[c] = 0.0f;
+            SegmentT[c] = SegmentSmooth[c] = 0.0f;
+            continue;
+        }
+
+        uint32_t cursor = ImClamp(Cursors[c], begin, end - 1);
+
+        // Playback moves by few keys at most, seeks are binary searched
+        uint32_t steps = 0;
+        while (cursor + 1 < end && (double) frames[cursor + 1] <= frame && steps < cursorLinearSteps)
+        {
+            cursor++;
+            steps++;
+        }
+        while (cursor > begin && (double) frames[cursor] > frame && steps < cursorLinearSteps)
+        {
+            cursor--;
+            steps++;
+        }
+        if (steps == cursorLinearSteps)
+            cursor = findKey(frames, begin, end, frame);
+
+        Cursors[c] = cursor;
+
+        const ImU8 interpolation = KeyInterpolations[cursor];
+        if (cursor + 1 == end || (double) frames[cursor] >= frame || interpolation == ImGuiNeoInterpolation_Constant)
+        {
+            // Before first key, after last key or holding value
+            SegmentFrom[c] = SegmentTo[c] = values[cursor];
+            SegmentT[c] = SegmentSmooth[c] = 0.0f;
+            continue;
+        }
+
+        SegmentFrom[c] = values[cursor];
+        SegmentTo[c] = values[cursor + 1];
+        SegmentT[c] = (float) ((frame - (double) frames[cursor]) / ((double) frames[cursor + 1] - (double) frames[cursor]));
+        SegmentSmooth[c] = interpolation == ImGuiNeoInterpolation_Smooth ? 1.0f : 0.0f;
+    }
+
+    // Blend pass, branch free so it vectorizes
+    float* __restrict results = Results.Data;
+    const float* __restrict from = SegmentFrom.Data;
+    const float* __restrict to = SegmentTo.Data;
+    const float* __restrict t = SegmentT.Data;
+    const float* __restrict smooth = SegmentSmooth.Data;
+
+    for (int c = 0; c < channelCount; c++)
+    {
+        const float linear = t[c];
+        const float eased = linear * linear * (3.0f - 2.0f * linear);
+        const float weight = linear + smooth[c] * (eased - linear);
+        results[c] = from[c] + (to[c] - from[c]) * weight;
+    }
+
+    return Results.Data;
+}
@@ -0,0 +1,53 @@
+//
+// Batched keyframe evaluation, lives alongside imgui_neo_sequencer
+//
+
+#ifndef IMGUI_NEO_EVALUATOR_H
+#define IMGUI_NEO_EVALUATOR_H
+
+#include "imgui.h"
+#include <cstdint>
+
+typedef int ImGuiNeoInterpolation;
+
+// Interpolation between key and the following one
+enum ImGuiNeoInterpolation_
+{
+    ImGuiNeoInterpolation_Constant,
+    ImGuiNeoInterpolation_Linear,
+    ImGuiNeoInterpolation_Smooth, // Smoothstep ease in / out
+};
+
+// Evaluates thousands of keyframed channels at once.
+// Keys of all channels are stored as structure of arrays, every channel keeps cursor to its last evaluated key,
+// so sequential playback costs O(1) per channel, random seeks fall back to binary search.
+// Blending itself is done in a single branch free pass over all channels, which compilers vectorize.
+struct ImGuiNeoEvaluator
+{
+    ImVector<int32_t>   KeyFrames;              // Keys of all channels, channel c owns [ChannelStarts[c], ChannelStarts[c + 1])
+    ImVector<float>     KeyValues;
+    ImVector<ImU8>      KeyInterpolations;      // ImGuiNeoInterpolation per key
+    ImVector<uint32_t>  ChannelStarts;
+
+    ImVector<uint32_t>  Cursors;                // Per channel index of key at or before last evaluated frame
+    ImVector<float>     Results;                // Per channel value at last evaluated frame
+
+    // Scratch of gather pass
+    ImVector<float>     SegmentFrom;
+    ImVector<float>     SegmentTo;
+    ImVector<float>     SegmentT;
+    ImVector<float>     SegmentSmooth;
+
+    ImGuiNeoEvaluator();
+
+    // Adds channel, keys have to be sorted by frame. Interpolations are optional, linear is used without them. Returns channel index.
+    int             AddChannel(const int32_t* frames, const float* values, const ImU8* interpolations, uint32_t count);
+    int             GetChannelCount() const { return ChannelStarts.Size - 1; }
+    void            Clear();
+
+    // Evaluates all channels at frame, returns array of GetChannelCount() values (same as Results).
+    // Frame is double so fractional frames stay exact on long sequences, float can't tell frames apart above 2^24.
+    const float*    Evaluate(double frame);
+};
+
+#endif //IMGUI_NEO_EVALUATOR_H
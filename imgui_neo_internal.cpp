@@ -27,7 +27,7 @@ namespace ImGui {
     }
 
     void
-    RenderNeoSequencerTopBarOverlay(float zoom, float valuesWidth,uint32_t startFrame, uint32_t endFrame, uint32_t offsetFrame, const ImVec2 &cursor, const ImVec2 &size,
+    RenderNeoSequencerTopBarOverlay(double zoom, float valuesWidth,uint32_t startFrame, uint32_t endFrame, uint32_t offsetFrame, const ImVec2 &cursor, const ImVec2 &size,
                                     ImDrawList *drawList, bool drawFrameLines,
                                     bool drawFrameText, float maxPixelsPerTick) {
         if(!drawList) drawList = ImGui::GetWindowDrawList();
@@ -40,7 +40,7 @@ namespace ImGui {
         const uint32_t viewStart = startFrame + offsetFrame;
 
         if(drawFrameLines) {
-            const auto count = (int32_t)((float)((viewEnd + 1) - viewStart) / zoom);
+            const auto count = (int32_t)((double)((viewEnd + 1) - viewStart) / zoom);
 
             int32_t counter = 0;
             uint32_t primaryFrames = pow(10, counter++);
@@ -121,14 +121,15 @@ namespace ImGui {
         }
     }
 
-    float GetPerFrameWidth(float totalSizeX, float valuesWidth, uint32_t endFrame, uint32_t startFrame, float zoom) {
+    float GetPerFrameWidth(float totalSizeX, float valuesWidth, uint32_t endFrame, uint32_t startFrame, double zoom) {
         const auto& imStyle = GetStyle();
 
         const auto size = totalSizeX - valuesWidth - imStyle.FramePadding.x;
 
         auto count = (endFrame + 1) - startFrame;
 
-        return ((size / (float)count) * zoom);
+        // Computed in double, zoom can reach frame count of very long sequences
+        return (float)(((double)size / (double)count) * zoom);
     }
 
     struct Vec2Pair {
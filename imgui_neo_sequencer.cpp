@@ -8,6 +8,52 @@
 #include "imgui_neo_internal.h"
 
 #include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <list>
+
+// Cached window of lane keyframes
+struct ImGuiNeoLaneWindow
+{
+    enum class WindowState
+    {
+        Pending, // Waiting for fetch
+        Ready,
+        Failed
+    };
+
+    WindowState State = WindowState::Pending;
+    int LastUsedFrame = 0;
+    int FailedFrame = 0; // Frame of failed fetch, window is fetched again after laneWindowRetryFrames
+    bool Requested = false; // Key is queued in provider Requests
+    size_t Memory = 0;
+    std::vector<ImGui::FrameIndexType> Keyframes;
+    std::list<uint64_t>::iterator LruPosition;
+};
+
+struct ImGuiNeoLaneProvider
+{
+    ImGui::NeoLaneFetchFunc Fetch = nullptr;
+    void* UserData = nullptr;
+    size_t MemoryBudget = 0;
+    ImGui::FrameIndexType WindowSize = 1024;
+
+    std::mutex Mutex; // Guards everything below, never held during fetch
+    std::condition_variable WakeUp;
+    std::thread Worker;
+    bool Quit = false;
+    std::atomic<int> CurrentFrame{0};
+
+    std::unordered_map<uint64_t, ImGuiNeoLaneWindow> Windows; // Key is lane id in high and window index in low bits
+    std::list<uint64_t> Lru; // Ready windows, most recently used first
+    std::vector<uint64_t> Requests; // Newest last, so current view is fetched first
+    size_t MemoryUsed = 0;
+    int LastSweepFrame = 0; // Frame in which unused pending and failed windows were last released
+};
 
 namespace ImGui
 {
@@ -16,6 +62,8 @@ namespace ImGui
     {
         ImGuiID TimelineID;
         ImVector<int32_t> KeyframesToDelete;
+        ImVector<uint32_t> SelectedKeys; // Keys of selected keyframes (indices for bulk timelines)
+        bool KeysSorted; // SelectedKeys are sorted and unique
     };
 
     // Internal struct holding how many times was keyframe on certain frame rendered, used as offset for duplicates
@@ -25,6 +73,123 @@ namespace ImGui
         uint32_t Count;
     };
 
+    // Internal struct holding recorded geometry of timeline keyframes, spliced back while timeline data and view are unchanged
+    struct ImGuiNeoLaneDrawCache
+    {
+        ImGuiID Key = 0; // Hash of everything that shapes lane output, 0 = empty
+        int LastUsedFrame = 0; // ImGui frame of last use, unused caches are released
+        ImVec2 Origin = {0, 0}; // Lane cursor at time of recording, cached vertices are translated by difference
+        ImGuiID DataHash = 0; // Frame data hashed by keyframes while recording, hashed again when spliced
+        ImVec4 ClipRect = {0, 0, 0, 0}; // Draw command state at time of recording, vertices only fit same command
+        ImTextureID TextureId = 0;
+        ImVec2 TexUvWhitePixel = {0, 0}; // Changes when font atlas is rebuilt
+        ImVector<ImDrawVert> Vertices;
+        ImVector<ImDrawIdx> Indices; // Relative to first cached vertex
+    };
+
+    // Internal node of zone interval tree, nodes are sorted by start and form implicit balanced tree
+    struct ImGuiNeoZoneTreeNode
+    {
+        FrameIndexType From;
+        FrameIndexType To;
+        FrameIndexType MaxTo; // Biggest end in subtree rooted in this node
+        uint32_t Index; // Index of zone in user array
+        uint32_t Row; // Sub-row zone is stacked into
+        uint32_t RowCount; // Sub-rows used by zones up to this one
+    };
+
+    // Internal end of sub-row, kept in min-heap during row assignment
+    struct ImGuiNeoZoneRowEnd
+    {
+        FrameIndexType To;
+        uint32_t Row;
+    };
+
+    // Internal interval tree over zones of one NeoActiveZones() call, rebuilt only when zones change
+    struct ImGuiNeoZoneTree
+    {
+        ImGuiID DataHash = 0;
+        int LastUsedFrame = 0; // ImGui frame of last use, unused trees are released
+        uint32_t RowCount = 1;
+        ImVector<ImGuiNeoZoneTreeNode> Nodes;
+        ImVector<uint32_t> Positions; // Position of each zone in Nodes
+        ImVector<ImGuiNeoZoneRowEnd> RowEnds; // Scratch used for row assignment
+        ImVector<bool> RowFound; // Scratch used to recover row ends before relayout start
+    };
+
+    // Internal copy of keyframe of provided lane, emitted after provider lock is released
+    struct ImGuiNeoProvidedKeyframe
+    {
+        FrameIndexType Frame;
+        uint32_t Key;
+    };
+
+    // Internal state of sub-pixel zone merging, one per row
+    struct ImGuiNeoZoneMerge
+    {
+        bool Merging;
+        FrameIndexType From;
+        FrameIndexType To;
+    };
+
+    // Internal tessellation cache of curve lane, points are relative to lane and grouped per key segment
+    struct ImGuiNeoCurveCache
+    {
+        ImGuiID ViewHash = 0; // Hash of sequence range, zoom, size and scale, 0 = empty
+        int LastUsedFrame = 0; // ImGui frame of last use, unused caches are released
+        uint32_t Generation = 0;
+        bool HasGeneration = false;
+        bool Envelope = false; // More keys than pixels, points are min / max per pixel column
+        int FirstKey = 0; // First key of cached segments
+        int LastKey = 0; // One past last key of cached segments
+        FrameIndexType OffsetFrame = 0; // View offset points were tessellated at, points are translated by pan since
+        ImVector<ImGuiID> SegmentHashes;
+        ImVector<int> SegmentStarts; // Offset of segment in Points, one more than segments
+        ImVector<ImVec2> Points;
+
+        // Double buffers of rebuild
+        ImVector<ImGuiID> NextSegmentHashes;
+        ImVector<int> NextSegmentStarts;
+        ImVector<ImVec2> NextPoints;
+    };
+
+    // Last known frame of keyframe shown in zoom bar minimap
+    struct ImGuiNeoMinimapKey
+    {
+        FrameIndexType Frame;
+        uint32_t LastSeen; // Minimap frame in which keyframe was submitted
+    };
+
+    // Keyframes of one timeline shown in minimap, keyframes not submitted by complete lane were deleted
+    struct ImGuiNeoMinimapLane
+    {
+        std::unordered_map<ImGuiID, ImGuiNeoMinimapKey> Keys;
+        uint32_t SeenCount = 0; // Keyframes submitted this frame
+        uint32_t LastSubmitted = 0; // Minimap frame in which lane was last begun
+        bool Complete = true; // All keyframes of lane were submitted this frame (no culling or cached geometry)
+    };
+
+    // Child window name of sequencer, formatted once per id
+    struct ImGuiNeoChildName
+    {
+        char Name[64];
+        int LastUsedFrame = 0;
+    };
+
+    // Measured size of label, released when not measured for style.UnusedContextFrames
+    struct ImGuiNeoLabelSize
+    {
+        ImVec2 Size;
+        int LastUsedFrame = 0;
+    };
+
+    // Width of timeline label in values column
+    struct ImGuiNeoLabelWidth
+    {
+        float Width = 0.0f;
+        int LastUsedFrame = 0;
+    };
+
     enum class SelectionState
     {
         Idle, // Doing nothing related
@@ -32,6 +197,8 @@ namespace ImGui
         Dragging    // Dragging selection
     };
 
+    static const float minValuesWidth = 32.0f; // Values column width without labels
+
     struct ImGuiNeoSequencerInternalData
     {
         ImVec2 TopLeftCursor = {0, 0};   // Cursor on top of whole widget
@@ -46,13 +213,25 @@ namespace ImGui
         FrameIndexType EndFrame = 0;
         FrameIndexType OffsetFrame = 0; // Offset from start
 
-        float ValuesWidth = 32.0f; // Width of biggest label in timeline, used for offset of timeline
+        float ValuesWidth = minValuesWidth; // Width of biggest label in timeline, used for offset of timeline
+        std::unordered_map<ImGuiID, ImGuiNeoLabelWidth> LabelWidths; // Key is timeline id
+        float MaxLabelWidth = 0.0f; // Max of LabelWidths
+        bool MaxLabelWidthValid = true; // Widest label shrank or was released, max is recomputed in next BeginNeoSequencer
 
         float FilledHeight = 0.0f; // Height of whole sequencer
 
-        float Zoom = 1.0f;
+        double Zoom = 1.0; // Visible frame count is total frame count / Zoom, double to stay precise on long sequences
+        double ViewOffset = 0.0; // Fractional offset from start used by anchored zoom, OffsetFrame is its integer part
+
+        //View velocity, used by NeoGetPredictedViewRange
+        double LastViewStart = 0.0;
+        double LastViewWidth = 0.0;
+        double LastViewTime = -1.0;
+        double ViewStartVelocity = 0.0; // Frames per second
+        double ViewWidthVelocity = 0.0; // Frames per second
 
         ImGuiID Id;
+        int LastUsedFrame = 0; // ImGui frame of last BeginNeoSequencer, unused sequencers are released
 
         ImGuiID LastSelectedTimeline = 0;
         ImGuiID SelectedTimeline = 0;
@@ -65,8 +244,30 @@ namespace ImGui
         bool HoldingCurrentFrame = false; // Are we draging current frame?
         ImVec4 CurrentFrameColor; // Color of current frame, we have to save it because we render on EndNeoSequencer, but process at BeginneoSequencer
 
+        //Scrubbing
+        bool CoalesceScrub = false; // Frame is written at most once per ScrubEvaluationBudget while scrubbing
+        ImGuiNeoScrubState ScrubState = ImGuiNeoScrubState_None;
+        FrameIndexType RequestedFrame = 0; // Frame under pointer, newer than written frame while scrub is coalesced
+        double LastScrubWriteTime = 0.0;
+
         bool HoldingZoomSlider = false;
 
+        //Active zones
+        ImGuiID ZoneDraggingID = 0; // Zone or zone handle being dragged
+        ImVec2 ZoneDragStart = {0, 0};
+        int32_t ZoneDragStartValue[2] = {0, 0};
+        std::unordered_map<ImGuiID, ImGuiNeoZoneTree> ZoneTrees;
+        ImVector<uint32_t> ZoneQueryBuffer; // Scratch for visible stacked zones
+        ImVector<ImGuiNeoZoneMerge> ZoneMerges; // Scratch for sub-pixel merging
+        ImVector<uint32_t> ZoneEdits; // Scratch with indices of zones edited this call
+
+        //Curves
+        std::unordered_map<ImGuiID, ImGuiNeoCurveCache> CurveCaches;
+        ImVector<ImVec2> CurvePoints; // Scratch with translated points
+        ImGuiID CurveDraggingID = 0;
+        ImVec2 CurveDragStart = {0, 0};
+        NeoCurveKey CurveDragStartKey = {0, 0.0f, 0.0f, 0.0f};
+
         //Selection
         ImVector<ImGuiID> Selection; // Contains ids of keyframes
         ImVec2 SelectionMouseStart = {0, 0};
@@ -82,11 +283,71 @@ namespace ImGui
         bool IsLastKeyframeHovered = false;
         bool IsLastKeyframeSelected = false;
         bool IsLastKeyframeRightClicked = false;
+        uint32_t KeyframeCounter = 0; // Ordinal of next keyframe in current timeline, used as default keyframe key
+        ImVector<uint32_t> KeyframeCounterStack; // Counters of parent timelines, restored when nested timeline ends
+        NeoKeyframeAttributes KeyframeAttributes; // Per keyframe arrays of current timeline
+        bool HasKeyframeAttributes = false;
+        int KeyframeAttributeIndex = -1; // Index of submitted keyframe in attribute arrays, -1 = keyframe has none
 
         //Deletion
         bool DeleteDataDirty = false;
         bool DeleteEnabled = true;
         ImVector<ImGuiNeoTimelineKeyframes> SelectionData;
+        uint32_t SelectionVersion = 0; // Incremented on every selection change, invalidates lane caches
+
+        //Lane caching
+        ImGuiID StyleHash = 0; // Hash of style values affecting lane geometry, computed in BeginNeoSequencer
+        uint32_t TimelineGeneration = 0; // Data generation of current timeline
+        bool HasTimelineGeneration = false; // Was generation supplied for current timeline?
+        std::unordered_map<ImGuiID, ImGuiNeoLaneDrawCache> LaneCaches;
+
+        //Change detection
+        ImGuiID FrameDataHash = 0; // Hash of data submitted this frame
+        ImGuiID LastOutputHash = 0; // Hash of everything affecting output last frame
+        ImGuiID HoveredItem = 0; // Sequencer item hovered this frame, affects its color
+
+        //Draw statistics
+        int DrawVtxStart = 0; // Draw list buffer sizes at BeginNeoSequencer
+        int DrawIdxStart = 0;
+        int DrawCmdStart = 0;
+        NeoDrawStats DrawStats = {0, 0, 0, 0, 0};
+
+        //Vertex budget
+        uint32_t LaneCount = 0; // Lanes drawn so far this frame
+        uint32_t LastLaneCount = 0; // Lanes drawn last frame, used to split budget between lanes
+        uint32_t DegradedLanes = 0; // Lanes drawn as density strip this frame
+        ImVector<uint32_t> DensityBuffer; // Scratch with keyframes per pixel of degraded lane
+
+        //Lane providers
+        ImVector<ImGuiNeoProvidedKeyframe> ProvidedKeyframes; // Scratch with visible keyframes copied out of provider lock
+        ImVector<int32_t> ProvidedPlaceholders; // Scratch with indices of visible windows not fetched yet
+
+        //Events
+        ImVector<NeoEvent> Events; // Ring buffer of events of last frame, reallocated only when style.EventCapacity changes
+        int EventHead = 0; // Oldest event
+        int EventCount = 0;
+        uint32_t DroppedEvents = 0; // Events overwritten in ring buffer during last frame
+        ImGuiID HoveredKeyframe = 0; // Hovered this frame
+        ImGuiID LastHoveredKeyframe = 0;
+        FrameIndexType LastDragDelta = 0;
+        uint32_t EventSelectionVersion = 0; // SelectionVersion of last selection changed event
+
+        //Zoom bar minimap
+        bool MinimapEnabled = false;
+        uint32_t MinimapFrame = 0; // Incremented every frame, used to find deleted keyframes
+        std::unordered_map<ImGuiID, ImGuiNeoMinimapLane> MinimapLanes;
+        ImGuiNeoMinimapLane* MinimapLane = nullptr; // Lane of current timeline
+        ImVector<uint32_t> MinimapBuckets; // Keyframes per zoom bar pixel, updated incrementally on change
+        FrameIndexType MinimapStart = 0; // Range covered by buckets
+        FrameIndexType MinimapEnd = 0;
+
+        //Zoom bar overlay, text is formatted only when view or font changes
+        char ZoomOverlayText[32] = {0};
+        ImVec2 ZoomOverlaySize = {0, 0};
+        FrameIndexType ZoomOverlayStart = 0;
+        uint32_t ZoomOverlayEnd = 0;
+        ImFont* ZoomOverlayFont = nullptr;
+        float ZoomOverlayFontSize = 0.0f;
     };
 
     static ImGuiNeoSequencerStyle style; // NOLINT(cert-err58-cpp)
@@ -100,6 +361,25 @@ namespace ImGui
     // Current active sequencer
     static ImGuiID currentSequencer;
 
+    // Sequencer ended last, its draw stats are returned by GetNeoSequencerDrawStats()
+    static ImGuiID lastEndedSequencer = 0;
+
+    // ImGui frame in which unused sequencers were last released
+    static int lastCollectFrame = -1;
+
+    // Frames between sweeps of unused lane caches of live sequencers
+    static const int laneCollectInterval = 60;
+    static const double zoomWheelRangeSteps = 16.0; // Most mouse wheel steps between whole sequence and single frame
+
+    // Empty selection buffers bigger than this are freed instead of kept for reuse
+    static const int selectionTrimCapacity = 1024;
+
+    // Failed provider windows are fetched again, and unused not ready windows released, after this many frames
+    static const int laneWindowRetryFrames = 120;
+
+    // Time constant of view velocity smoothing, in seconds
+    static const double viewVelocitySmoothing = 0.1;
+
     // Current timeline depth, used for offset of label
     static uint32_t currentTimelineDepth = 0;
 
@@ -108,10 +388,285 @@ namespace ImGui
     // Data of all sequencers, this is main c++ part and I should create C alternative or use imgui ImVector or something
     static std::unordered_map<ImGuiID, ImGuiNeoSequencerInternalData> sequencerData;
 
+    static std::unordered_map<ImGuiID, ImGuiNeoChildName> sequencerChildNames;
+
     static ImVector<ImGuiNeoKeyframeDuplicate> keyframeDuplicates;
 
+    // Measured label sizes, key is hash of label text, font and font size
+    static std::unordered_map<ImGuiID, ImGuiNeoLabelSize> labelSizeCache;
+
+    // Set by SetNextNeoTimelineGeneration(), consumed by next BeginNeoTimelineEx()
+    static uint32_t nextTimelineGeneration = 0;
+    static bool hasNextTimelineGeneration = false;
+
+    // Set by SetNextNeoTimelineKeyframeAttributes(), consumed by next BeginNeoTimelineEx()
+    static NeoKeyframeAttributes nextKeyframeAttributes;
+    static bool hasNextKeyframeAttributes = false;
+
+    // Persistent worker threads used by NeoPrepareTimelines(), items of job are handed out dynamically so uneven timelines balance out
+    struct ImGuiNeoWorkerPool
+    {
+        typedef void (*JobFunc)(void* userData, uint32_t item);
+
+        std::vector<std::thread> Workers;
+        std::mutex RunMutex; // Serializes Run(), pool executes one job at a time
+        std::mutex Mutex;
+        std::condition_variable WakeUp;
+        std::condition_variable Finished;
+        uint32_t JobGeneration = 0;
+        uint32_t ActiveWorkers = 0;
+        bool Quit = false;
+
+        JobFunc Job = nullptr;
+        void* JobUserData = nullptr;
+        uint32_t JobItemCount = 0;
+        std::atomic<uint32_t> NextItem{0};
+
+        ~ImGuiNeoWorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                Quit = true;
+            }
+            WakeUp.notify_all();
+            for (auto& worker: Workers)
+                worker.join();
+        }
+
+        void RunItems()
+        {
+            for (uint32_t item = NextItem.fetch_add(1); item < JobItemCount; item = NextItem.fetch_add(1))
+                Job(JobUserData, item);
+        }
+
+        void WorkerMain()
+        {
+            uint32_t seenGeneration = 0;
+            std::unique_lock<std::mutex> lock(Mutex);
+            while (true)
+            {
+                WakeUp.wait(lock, [&] { return Quit || JobGeneration != seenGeneration; });
+                if (Quit)
+                    return;
+                seenGeneration = JobGeneration;
+
+                lock.unlock();
+                RunItems();
+                lock.lock();
+
+                if (--ActiveWorkers == 0)
+                    Finished.notify_one();
+            }
+        }
+
+        // Runs job over items on calling thread and up to threadCount - 1 workers, returns when all items are done.
+        // Concurrent callers wait for each other.
+        void Run(JobFunc job, void* userData, uint32_t itemCount, uint32_t threadCount)
+        {
+            std::lock_guard<std::mutex> runLock(RunMutex);
+
+            const uint32_t workerCount = ImMin(threadCount, itemCount) > 0 ? ImMin(threadCount, itemCount) - 1 : 0;
+
+            std::unique_lock<std::mutex> lock(Mutex);
+            while (Workers.size() < workerCount)
+                Workers.emplace_back([this] { WorkerMain(); });
+
+            Job = job;
+            JobUserData = userData;
+            JobItemCount = itemCount;
+            NextItem = 0;
+            ActiveWorkers = (uint32_t) Workers.size();
+            JobGeneration++;
+            lock.unlock();
+            WakeUp.notify_all();
+
+            RunItems();
+
+            lock.lock();
+            Finished.wait(lock, [&] { return ActiveWorkers == 0; });
+        }
+    };
+
+    static ImGuiNeoWorkerPool workerPool;
+
     ///////////// STATIC HELPERS ///////////////////////
 
+    // Cheap integer hash combine (murmur3 finalizer)
+    static ImGuiID hashMix(ImGuiID seed, uint32_t value)
+    {
+        ImGuiID h = seed ^ (value * 0x9E3779B9u);
+        h ^= h >> 16;
+        h *= 0x85EBCA6Bu;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+    // Hashed field by field, padding after bool members is indeterminate
+    static ImGuiID hashNeoStyle(const ImGuiNeoSequencerStyle& neoStyle)
+    {
+        const float values[] = {
+                neoStyle.SequencerRounding, neoStyle.TopBarHeight, neoStyle.ItemSpacing.x, neoStyle.ItemSpacing.y,
+                neoStyle.DepthItemSpacing, neoStyle.TopBarSpacing, neoStyle.TimelineBorderSize,
+                neoStyle.CurrentFramePointerSize, neoStyle.CurrentFrameLineWidth, neoStyle.ZoomHeightScale,
+                neoStyle.ZoomWheelFactor, neoStyle.CollidedKeyframeOffset, neoStyle.MaxSizePerTick,
+                neoStyle.CurveSegmentLength, neoStyle.CurveFlatness, neoStyle.ScrubEvaluationBudget
+        };
+
+        ImGuiID hash = ImHashData(values, sizeof(values));
+        hash = ImHashData(neoStyle.Colors, sizeof(neoStyle.Colors), hash);
+        hash = hashMix(hash, (uint32_t) neoStyle.TopBarShowFrameLines);
+        hash = hashMix(hash, (uint32_t) neoStyle.TopBarShowFrameTexts);
+        hash = hashMix(hash, (uint32_t) neoStyle.UnusedContextFrames);
+        hash = hashMix(hash, neoStyle.VertexBudget);
+        hash = hashMix(hash, (uint32_t) neoStyle.EventCapacity);
+        hash = hashMix(hash, (uint32_t) neoStyle.ModRemoveKey);
+        hash = hashMix(hash, (uint32_t) neoStyle.ModAddKey);
+        return hash;
+    }
+
+    // CalcTextSize() with results cached, unchanged labels aren't measured again
+    static ImVec2 calcLabelSize(const char* label)
+    {
+        const ImFont* font = GetFont();
+        const float fontSize = GetFontSize();
+        uint32_t fontSizeBits;
+        memcpy(&fontSizeBits, &fontSize, sizeof(fontSizeBits));
+
+        const ImGuiID seed = hashMix(hashMix(0, (uint32_t) (uintptr_t) font), fontSizeBits);
+        const ImGuiID key = ImHashStr(label, 0, seed);
+
+        auto& entry = labelSizeCache[key];
+        if (entry.LastUsedFrame == 0)
+            entry.Size = CalcTextSize(label);
+        entry.LastUsedFrame = ImMax(GetFrameCount(), 1);
+        return entry.Size;
+    }
+
+    // Values column is as wide as widest label, max is only recomputed when widest label shrinks or is released
+    static void setLabelWidth(ImGuiNeoSequencerInternalData& context, ImGuiID id, float width)
+    {
+        auto& entry = context.LabelWidths[id];
+        entry.LastUsedFrame = GetFrameCount();
+        if (entry.Width == width)
+            return;
+
+        if (width < entry.Width && entry.Width >= context.MaxLabelWidth)
+            context.MaxLabelWidthValid = false;
+        entry.Width = width;
+        context.MaxLabelWidth = ImMax(context.MaxLabelWidth, width);
+        context.ValuesWidth = ImMax(context.ValuesWidth, width); // Make left panel wide enough
+    }
+
+    static void updateValuesWidth(ImGuiNeoSequencerInternalData& context)
+    {
+        if (context.MaxLabelWidthValid)
+            return;
+
+        context.MaxLabelWidth = 0.0f;
+        for (auto&& entry : context.LabelWidths)
+            context.MaxLabelWidth = ImMax(context.MaxLabelWidth, entry.second.Width);
+        context.ValuesWidth = ImMax(context.MaxLabelWidth, minValuesWidth);
+        context.MaxLabelWidthValid = true;
+    }
+
+    // Accumulates data submitted this frame, used to detect if sequencer output changed
+    static void hashFrameData(ImGuiNeoSequencerInternalData& context, uint32_t value)
+    {
+        context.FrameDataHash = hashMix(context.FrameDataHash, value);
+    }
+
+    static void pushEvent(ImGuiNeoSequencerInternalData& context, ImGuiNeoEventType type, ImGuiID timelineId,
+                          uint32_t key, FrameIndexType frame, FrameIndexType delta)
+    {
+        if (context.EventCount == context.Events.Size)
+        {
+            context.EventHead = (context.EventHead + 1) % context.Events.Size;
+            context.EventCount--;
+            context.DroppedEvents++;
+        }
+        context.Events[(context.EventHead + context.EventCount) % context.Events.Size] = {type, timelineId, key, frame, delta};
+        context.EventCount++;
+    }
+
+    // ImVector doesn't destruct elements, nested buffers have to be freed first
+    static void clearSelectionData(ImGuiNeoSequencerInternalData& context)
+    {
+        for (auto&& data: context.SelectionData)
+        {
+            data.KeyframesToDelete.clear();
+            data.SelectedKeys.clear();
+        }
+        context.SelectionData.resize(0);
+    }
+
+    // Gives memory of big cleared selection back
+    static void trimSelectionCapacity(ImGuiNeoSequencerInternalData& context)
+    {
+        if (context.Selection.empty() && context.Selection.Capacity > selectionTrimCapacity)
+            context.Selection.clear();
+        if (context.SelectionData.empty() && context.SelectionData.Capacity > selectionTrimCapacity)
+            context.SelectionData.clear();
+        if (context.DraggingSelectionStart.empty() && context.DraggingSelectionStart.Capacity > selectionTrimCapacity)
+            context.DraggingSelectionStart.clear();
+    }
+
+    // Releases cache entries (per lane caches, labels, child names) not used for style.UnusedContextFrames
+    template<typename CacheMap>
+    static void collectUnusedLaneCaches(CacheMap& caches, int frameCount)
+    {
+        for (auto it = caches.begin(); it != caches.end();)
+        {
+            if (frameCount - it->second.LastUsedFrame > style.UnusedContextFrames)
+                it = caches.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // Releases state of sequencers not begun for style.UnusedContextFrames, runs once per frame
+    static void collectUnusedSequencers()
+    {
+        const int frameCount = GetFrameCount();
+        if (style.UnusedContextFrames <= 0 || lastCollectFrame == frameCount)
+            return;
+        lastCollectFrame = frameCount;
+
+        // Lane caches of live sequencers are swept less often, there can be many of them
+        const bool collectLanes = frameCount % laneCollectInterval == 0;
+
+        for (auto it = sequencerData.begin(); it != sequencerData.end();)
+        {
+            auto& context = it->second;
+            if (frameCount - context.LastUsedFrame > style.UnusedContextFrames)
+            {
+                clearSelectionData(context);
+                it = sequencerData.erase(it);
+                continue;
+            }
+
+            if (collectLanes)
+            {
+                collectUnusedLaneCaches(context.LaneCaches, frameCount);
+                collectUnusedLaneCaches(context.CurveCaches, frameCount);
+                collectUnusedLaneCaches(context.ZoneTrees, frameCount);
+
+                const size_t labelCount = context.LabelWidths.size();
+                collectUnusedLaneCaches(context.LabelWidths, frameCount);
+                if (context.LabelWidths.size() != labelCount)
+                    context.MaxLabelWidthValid = false;
+            }
+            ++it;
+        }
+
+        if (collectLanes)
+        {
+            collectUnusedLaneCaches(labelSizeCache, frameCount);
+            collectUnusedLaneCaches(sequencerChildNames, frameCount);
+        }
+    }
+
     static float getPerFrameWidth(ImGuiNeoSequencerInternalData& context)
     {
         return GetPerFrameWidth(context.Size.x, context.ValuesWidth, context.EndFrame, context.StartFrame,
@@ -124,12 +679,69 @@ namespace ImGui
         return (float) (frame - context.OffsetFrame - context.StartFrame) * perFrameWidth;
     }
 
+    // Converts horizontal mouse movement to amount of frames in current view
+    static FrameIndexType getFrameDelta(ImGuiNeoSequencerInternalData& context, float pixelDelta)
+    {
+        const auto perFrameWidth = (double) getPerFrameWidth(context);
+        if (perFrameWidth <= 0.0)
+            return 0;
+        return (FrameIndexType) round((double) pixelDelta / perFrameWidth);
+    }
+
+    static const int keyframeCircleSegments = 8; // Segments of ImGuiNeoKeyframeShape_Circle, keyframes stay cheap for vertex budget
+    static const uint32_t plotLineVertexCount = 8; // Anti-aliased line, upper bound
+
+    // Vertices emitted by keyframe of given shape, anti-aliased fill has 2 vertices per point
+    static uint32_t getKeyframeVertexCount(ImU8 shape)
+    {
+        switch (shape)
+        {
+            case ImGuiNeoKeyframeShape_Circle:
+                return keyframeCircleSegments * 2;
+            case ImGuiNeoKeyframeShape_Square:
+                return 4; // Axis aligned rect has no fringe
+            case ImGuiNeoKeyframeShape_Triangle:
+                return 3 * 2;
+            default:
+                return 4 * 2; // Diamond is circle with 4 segments
+        }
+    }
+
+    // Vertices emitted by keyframe of current timeline with given attribute index (-1 = keyframe has no attributes)
+    static uint32_t getKeyframeVertexCount(ImGuiNeoSequencerInternalData& context, int attributeIndex)
+    {
+        if (context.HasKeyframeAttributes && context.KeyframeAttributes.Shapes && attributeIndex >= 0)
+            return getKeyframeVertexCount(context.KeyframeAttributes.Shapes[attributeIndex]);
+        return getKeyframeVertexCount(ImGuiNeoKeyframeShape_Diamond);
+    }
+
+    // Amount of vertices current lane can emit before it has to degrade, remaining budget is split between lanes left
+    static uint32_t getLaneVertexShare(ImGuiNeoSequencerInternalData& context)
+    {
+        if (style.VertexBudget == 0)
+            return UINT32_MAX;
+
+        const int used = GetWindowDrawList()->VtxBuffer.Size - context.DrawVtxStart;
+        const uint32_t remaining = used < (int) style.VertexBudget ? style.VertexBudget - (uint32_t) used : 0;
+        const uint32_t lanesLeft = context.LastLaneCount > context.LaneCount ?
+                                   context.LastLaneCount - context.LaneCount + 1 : 1;
+
+        return remaining / lanesLeft;
+    }
+
     static float getWorkTimelineWidth(ImGuiNeoSequencerInternalData& context)
     {
         const auto perFrameWidth = getPerFrameWidth(context);
         return context.Size.x - context.ValuesWidth - perFrameWidth;
     }
 
+    // Keyframe at offset from lane start is drawn, vertex count of lane is estimated with same test
+    static bool isKeyframeDrawn(ImGuiNeoSequencerInternalData& context, float timelineOffset)
+    {
+        const float radius = currentTimelineHeight / 3.0f;
+        return timelineOffset >= 0.0f && timelineOffset <= getWorkTimelineWidth(context) + radius;
+    }
+
     // Dont pull frame from context, its used for dragging
     static ImRect getCurrentFrameBB(FrameIndexType frame, ImGuiNeoSequencerInternalData& context)
     {
@@ -145,9 +757,33 @@ namespace ImGui
         return rect;
     }
 
+    // Tracks smoothed pan and zoom velocity of view, called after zoom bar is processed
+    static void updateViewVelocity(ImGuiNeoSequencerInternalData& context)
+    {
+        const double viewStart = (double) context.StartFrame + context.ViewOffset;
+        const double viewWidth = (double) ((context.EndFrame + 1) - context.StartFrame) / context.Zoom;
+        const double time = GetTime();
+        const double dt = time - context.LastViewTime;
+
+        if (context.LastViewTime >= 0.0 && dt > 0.0)
+        {
+            const double alpha = 1.0 - exp(-dt / viewVelocitySmoothing);
+
+            context.ViewStartVelocity += ((viewStart - context.LastViewStart) / dt - context.ViewStartVelocity) * alpha;
+            context.ViewWidthVelocity += ((viewWidth - context.LastViewWidth) / dt - context.ViewWidthVelocity) * alpha;
+        }
+
+        context.LastViewStart = viewStart;
+        context.LastViewWidth = viewWidth;
+        context.LastViewTime = time;
+    }
+
     static void processCurrentFrame(FrameIndexType* frame, ImGuiNeoSequencerInternalData& context)
     {
-        auto pointerRect = getCurrentFrameBB(*frame, context);
+        context.ScrubState = ImGuiNeoScrubState_None;
+
+        // Pointer follows mouse while held, written frame can lag behind when scrub is coalesced
+        auto pointerRect = getCurrentFrameBB(context.HoldingCurrentFrame ? context.RequestedFrame : *frame, context);
         pointerRect.Min -= ImVec2{2.0f, 2.0f};
         pointerRect.Max += ImVec2{2.0f, 2.0f};
 
@@ -160,12 +796,14 @@ namespace ImGui
                 timelineXmin + context.Size.x - context.ValuesWidth
         };
 
-        const auto hovered = ItemHoverable(pointerRect, GetCurrentWindow()->GetID("##_top_selector_neo"), ImGuiItemFlags_None);
+        const ImGuiID pointerID = GetCurrentWindow()->GetID("##_top_selector_neo");
+        const auto hovered = ItemHoverable(pointerRect, pointerID, ImGuiItemFlags_None);
 
         context.CurrentFrameColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointer);
 
         if (hovered)
         {
+            context.HoveredItem = pointerID;
             context.CurrentFrameColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointerHovered);
         }
 
@@ -180,19 +818,33 @@ namespace ImGui
 
                 const auto clamped = ImClamp(normalized, 0.0f, 1.0f);
 
-                const auto viewSize = (float) (context.EndFrame - context.StartFrame) / context.Zoom;
+                const auto viewSize = (double) (context.EndFrame - context.StartFrame) / context.Zoom;
 
-                const auto frameViewVal = (float) context.StartFrame + (clamped * (float) viewSize);
+                const auto frameViewVal = (double) context.StartFrame + ((double) clamped * viewSize);
 
                 const auto finalFrame = (FrameIndexType) round(frameViewVal) + context.OffsetFrame;
 
                 context.CurrentFrameColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointerPressed);
 
-                *frame = finalFrame;
+                context.RequestedFrame = finalFrame;
+
+                // Intermediate frames are dropped while last written one is still being evaluated
+                const double time = GetTime();
+                if (!context.CoalesceScrub || time - context.LastScrubWriteTime >= (double) style.ScrubEvaluationBudget)
+                {
+                    if (*frame != finalFrame)
+                        context.LastScrubWriteTime = time;
+                    *frame = finalFrame;
+                }
             }
 
+            context.ScrubState = ImGuiNeoScrubState_InFlight;
+
             if (!IsMouseDown(ImGuiMouseButton_Left))
             {
+                // Released pointer always writes latest frame
+                *frame = context.RequestedFrame;
+                context.ScrubState = ImGuiNeoScrubState_Settled;
                 context.HoldingCurrentFrame = false;
                 context.CurrentFrameColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointer);
             }
@@ -201,9 +853,14 @@ namespace ImGui
         if (hovered && IsMouseDown(ImGuiMouseButton_Left) && !context.HoldingCurrentFrame)
         {
             context.HoldingCurrentFrame = true;
+            context.RequestedFrame = *frame;
+            context.ScrubState = ImGuiNeoScrubState_InFlight;
             context.CurrentFrameColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointerPressed);
         }
 
+        if (context.CurrentFrame != *frame)
+            pushEvent(context, ImGuiNeoEventType_CurrentFrameChanged, 0, 0, *frame, *frame - context.CurrentFrame);
+
         context.CurrentFrame = *frame;
     }
 
@@ -226,7 +883,8 @@ namespace ImGui
                ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_Keyframe));
     }
 
-    static void addKeyframeToDeleteData(int32_t value, ImGuiNeoSequencerInternalData& context, const ImGuiID timelineId)
+    static void addKeyframeToDeleteData(int32_t value, uint32_t key, ImGuiNeoSequencerInternalData& context,
+                                        const ImGuiID timelineId)
     {
         bool foundTimeline = false;
         for (auto&& val: context.SelectionData)
@@ -236,6 +894,9 @@ namespace ImGui
                 foundTimeline = true;
                 if (!val.KeyframesToDelete.contains(value))
                     val.KeyframesToDelete.push_back(value);
+                // Keys are deduplicated when sorted on request
+                val.SelectedKeys.push_back(key);
+                val.KeysSorted = false;
                 break;
             }
         }
@@ -246,18 +907,21 @@ namespace ImGui
             auto& data = context.SelectionData.back();
             data.TimelineID = timelineId;
             data.KeyframesToDelete.push_back(value);
+            data.SelectedKeys.push_back(key);
+            data.KeysSorted = true;
         }
     }
 
     static bool
-    getKeyframeInSelection(int32_t value, ImGuiID id, ImGuiNeoSequencerInternalData& context, const ImRect bb)
+    getKeyframeInSelection(int32_t value, uint32_t key, ImGuiID id, ImGuiNeoSequencerInternalData& context,
+                           const ImRect bb)
     {
         //TODO(matej.vrba): This is kinda slow, it works for smaller data sample, but for bigger sample it should be changed to hashset
         const ImGuiID timelineId = context.TimelineStack.back();
 
         if (context.DeleteDataDirty && context.Selection.contains(id))
         {
-            addKeyframeToDeleteData(value, context, timelineId);
+            addKeyframeToDeleteData(value, key, context, timelineId);
         }
 
         if (context.StateOfSelection != SelectionState::Selecting)
@@ -294,10 +958,14 @@ namespace ImGui
                 if (val.TimelineID == timelineId)
                 {
                     val.KeyframesToDelete.find_erase(value);
+                    // Not yet deduplicated keys can be in there more than once, order is kept so sorted stay sorted
+                    val.SelectedKeys.resize((int) (std::remove(val.SelectedKeys.begin(), val.SelectedKeys.end(), key) -
+                                                   val.SelectedKeys.begin()));
                     break;
                 }
             }
-            context.Selection.find_erase(id);
+            if (context.Selection.find_erase(id))
+                context.SelectionVersion++;
         };
 
         if (overlaps)
@@ -310,9 +978,10 @@ namespace ImGui
             {
                 if (!context.Selection.contains(id))
                 {
-                    addKeyframeToDeleteData(value, context, timelineId);
+                    addKeyframeToDeleteData(value, key, context, timelineId);
 
                     context.Selection.push_back(id);
+                    context.SelectionVersion++;
                 }
             }
         } else
@@ -328,17 +997,100 @@ namespace ImGui
         return overlaps;
     }
 
-    static ImGuiID getKeyframeID(int32_t* frame)
+    // Cheap integer mix of timeline id and keyframe key, stays valid when user storage reallocates
+    static ImGuiID getKeyframeID(ImGuiID timelineId, uint32_t key)
+    {
+        const ImGuiID h = hashMix(timelineId, key);
+        return h != 0 ? h : 1; // 0 is reserved for "no id"
+    }
+
+    static void addMinimapBucket(ImGuiNeoSequencerInternalData& context, FrameIndexType frame, int delta)
+    {
+        auto& buckets = context.MinimapBuckets;
+        if (buckets.empty() || frame < context.MinimapStart || frame > context.MinimapEnd)
+            return;
+
+        const double range = (double) (context.MinimapEnd - context.MinimapStart) + 1.0;
+        const int index = ImMin((int) ((double) (frame - context.MinimapStart) / range * buckets.Size), buckets.Size - 1);
+        buckets[index] = (uint32_t) ((int) buckets[index] + delta);
+    }
+
+    // Only new, moved and deleted keyframes touch buckets
+    static void updateMinimapKey(ImGuiNeoSequencerInternalData& context, ImGuiID id, FrameIndexType frame)
+    {
+        auto& lane = *context.MinimapLane;
+        auto it = lane.Keys.find(id);
+
+        if (it == lane.Keys.end())
+        {
+            it = lane.Keys.insert({id, {frame, 0}}).first;
+            addMinimapBucket(context, frame, 1);
+        }
+        else if (it->second.Frame != frame)
+        {
+            addMinimapBucket(context, it->second.Frame, -1);
+            addMinimapBucket(context, frame, 1);
+            it->second.Frame = frame;
+        }
+
+        if (it->second.LastSeen != context.MinimapFrame)
+        {
+            it->second.LastSeen = context.MinimapFrame;
+            lane.SeenCount++;
+        }
+    }
+
+    static void sweepMinimapLane(ImGuiNeoSequencerInternalData& context, ImGuiNeoMinimapLane& lane)
+    {
+        if (!lane.Complete || lane.SeenCount >= (uint32_t) lane.Keys.size())
+            return;
+
+        for (auto it = lane.Keys.begin(); it != lane.Keys.end();)
+        {
+            if (it->second.LastSeen != context.MinimapFrame)
+            {
+                addMinimapBucket(context, it->second.Frame, -1);
+                it = lane.Keys.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    // Lanes not begun this frame (removed or in collapsed group) are dropped from minimap
+    static void pruneMinimapLanes(ImGuiNeoSequencerInternalData& context)
     {
-        return GetCurrentWindow()->GetID(frame);
+        for (auto it = context.MinimapLanes.begin(); it != context.MinimapLanes.end();)
+        {
+            if (it->second.LastSubmitted == context.MinimapFrame)
+            {
+                ++it;
+                continue;
+            }
+            for (const auto& key: it->second.Keys)
+                addMinimapBucket(context, key.second.Frame, -1);
+            it = context.MinimapLanes.erase(it);
+        }
     }
 
-    static bool createKeyframe(int32_t* frame)
+    // Timeline offset is position of keyframe relative to start of timeline (getKeyframePositionX)
+    static bool createKeyframe(int32_t* frame, ImGuiID key, float timelineOffset)
     {
         const auto& imStyle = GetStyle();
         auto& context = sequencerData[currentSequencer];
 
-        const auto timelineOffset = getKeyframePositionX(*frame, context);
+        ImU32 attributeColor = 0;
+        ImU8 shape = ImGuiNeoKeyframeShape_Diamond;
+        ImU8 keyframeFlags = ImGuiNeoKeyframeFlags_None;
+        if (context.HasKeyframeAttributes && context.KeyframeAttributeIndex >= 0)
+        {
+            const auto& attributes = context.KeyframeAttributes;
+            const int index = context.KeyframeAttributeIndex;
+            if (attributes.Colors) attributeColor = attributes.Colors[index];
+            if (attributes.Shapes) shape = attributes.Shapes[index];
+            if (attributes.Flags) keyframeFlags = attributes.Flags[index];
+            hashFrameData(context, hashMix(attributeColor, (uint32_t) shape | ((uint32_t) keyframeFlags << 8)));
+        }
 
         float offset = 0.0f;
 
@@ -367,9 +1119,11 @@ namespace ImGui
 
         const auto drawList = ImGui::GetWindowDrawList();
 
-        const ImGuiID id = getKeyframeID(frame);
+        const ImGuiID id = getKeyframeID(context.TimelineStack.back(), key);
 
         bool hovered = ItemHoverable(bb, id, ImGuiItemFlags_None);
+        if (hovered)
+            context.HoveredItem = id;
 
         if (context.SelectionEnabled && context.Selection.contains(id) &&
             (context.StateOfSelection != SelectionState::Selecting))
@@ -399,29 +1153,69 @@ namespace ImGui
                 }
                 float mouseDelta = GetMousePos().x - context.DraggingMouseStart.x;
 
-                auto offsetA = int32_t(
-                        (1.f/context.Zoom) * (mouseDelta / (context.Size.x / (float) context.EndFrame - (float) context.StartFrame)));
+                auto offsetA = getFrameDelta(context, mouseDelta);
 
-                *frame = context.DraggingSelectionStart[index] + offsetA;
+                if (!(keyframeFlags & ImGuiNeoKeyframeFlags_Locked))
+                    *frame = context.DraggingSelectionStart[index] + offsetA;
             }
         }
 
-        const bool inSelection = getKeyframeInSelection(*frame, id, context, bb);
+        const bool inSelection = getKeyframeInSelection(*frame, key, id, context, bb);
 
         context.IsLastKeyframeSelected = inSelection;
 
-        if (timelineOffset >= 0.0f)
+        hashFrameData(context, id);
+        hashFrameData(context, (uint32_t) *frame);
+
+        if (context.MinimapLane)
+            updateMinimapKey(context, id, *frame);
+
+        if (isKeyframeDrawn(context, timelineOffset))
         {
 
             ImColor color = getKeyframeColor(context, hovered, inSelection);
+            if (attributeColor != 0 && !hovered && !inSelection)
+                color = attributeColor;
+            if (keyframeFlags & ImGuiNeoKeyframeFlags_Muted)
+                color.Value.w *= 0.35f;
+
+            const ImVec2 center = pos + ImVec2{0, currentTimelineHeight / 2.f};
+            const float radius = currentTimelineHeight / 3.0f;
 
-            drawList->AddCircleFilled(pos + ImVec2{0, currentTimelineHeight / 2.f}, currentTimelineHeight / 3.0f,
-                                      color, 4);
+            switch (shape)
+            {
+                case ImGuiNeoKeyframeShape_Circle:
+                    drawList->AddCircleFilled(center, radius, color, keyframeCircleSegments);
+                    break;
+                case ImGuiNeoKeyframeShape_Square:
+                    drawList->AddRectFilled(center - ImVec2{radius, radius} * 0.75f, center + ImVec2{radius, radius} * 0.75f,
+                                            color);
+                    break;
+                case ImGuiNeoKeyframeShape_Triangle:
+                    drawList->AddTriangleFilled(center + ImVec2{0, -radius}, center + ImVec2{radius, radius * 0.75f},
+                                                center + ImVec2{-radius, radius * 0.75f}, color);
+                    break;
+                default:
+                    drawList->AddCircleFilled(center, radius, color, 4);
+                    break;
+            }
         }
 
         context.IsLastKeyframeHovered = hovered;
         context.IsLastKeyframeRightClicked = hovered && IsMouseClicked(ImGuiMouseButton_Right);
 
+        if (hovered)
+        {
+            const ImGuiID timelineId = context.TimelineStack.back();
+            if (id != context.LastHoveredKeyframe)
+                pushEvent(context, ImGuiNeoEventType_KeyframeHovered, timelineId, key, *frame, 0);
+            if (IsMouseClicked(ImGuiMouseButton_Left))
+                pushEvent(context, ImGuiNeoEventType_KeyframeClicked, timelineId, key, *frame, 0);
+            if (context.IsLastKeyframeRightClicked)
+                pushEvent(context, ImGuiNeoEventType_KeyframeRightClicked, timelineId, key, *frame, 0);
+            context.HoveredKeyframe = id;
+        }
+
         if (context.Selection.contains(id) && context.IsLastKeyframeRightClicked)
         {
             context.IsSelectionRightClicked = true;
@@ -430,60 +1224,263 @@ namespace ImGui
         return true;
     }
 
-    static uint32_t idCounter = 0;
-    static char idBuffer[16];
-
-    const char* generateID()
+    // Draws keyframes of current lane as strip of pixel columns, more keyframes in column = more opaque
+    static void drawDensityStrip(ImGuiNeoSequencerInternalData& context, const uint32_t* density, int count, float laneTop)
     {
-        idBuffer[0] = '#';
-        idBuffer[1] = '#';
-        memset(idBuffer + 2, 0, 14);
-        snprintf(idBuffer + 2, 14, "%o", idCounter++);
+        const auto& imStyle = GetStyle();
+        auto* drawList = GetWindowDrawList();
+        const ImVec4 baseColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_Keyframe);
+        const float x = context.StartValuesCursor.x + imStyle.FramePadding.x + context.ValuesWidth;
+        const float y = laneTop + currentTimelineHeight / 4.0f;
 
-        return &idBuffer[0];
+        for (int i = 0; i < count; i++)
+        {
+            if (density[i] == 0)
+                continue;
+            hashFrameData(context, hashMix((ImGuiID) i, density[i]));
+            ImVec4 color = baseColor;
+            color.w = ImMin(1.0f, baseColor.w * (0.5f + (float) density[i] * 0.25f));
+            drawList->AddRectFilled({x + (float) i, y}, {x + (float) i + 1.0f, y + currentTimelineHeight / 2.0f},
+                                    ColorConvertFloat4ToU32(color));
+        }
     }
 
-    void resetID()
+    // Zeroed keyframes per pixel scratch for lane which exceeded its vertex share
+    static ImVector<uint32_t>& resetDensityBuffer(ImGuiNeoSequencerInternalData& context)
     {
-        idCounter = 0;
+        auto& density = context.DensityBuffer;
+        density.resize(ImMax((int) getWorkTimelineWidth(context), 0));
+        if (!density.empty())
+            memset(density.Data, 0, density.size_in_bytes());
+        return density;
     }
 
-    static void renderCurrentFrame(ImGuiNeoSequencerInternalData& context)
+    static void addKeyframeDensity(ImVector<uint32_t>& density, float timelineOffset)
     {
-        const auto bb = getCurrentFrameBB(context.CurrentFrame, context);
-
-        const auto drawList = ImGui::GetWindowDrawList();
+        if (timelineOffset >= 0.0f && timelineOffset < (float) density.Size)
+            density[(int) timelineOffset]++;
+    }
 
-        RenderNeoSequencerCurrentFrame(
-                GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointerLine),
-                context.CurrentFrameColor,
-                bb,
-                context.Size.y - context.TopBarSize.y,
-                style.CurrentFrameLineWidth,
-                drawList
-        );
+    // Keyframe of bulk timeline, key is also its index in keyframe attribute arrays
+    static void submitKeyframe(ImGuiNeoSequencerInternalData& context, FrameIndexType* frame, uint32_t key)
+    {
+        context.KeyframeCounter++;
+        context.KeyframeAttributeIndex = (int) key;
+        createKeyframe(frame, key, getKeyframePositionX(*frame, context));
+        context.KeyframeAttributeIndex = -1;
     }
 
-    static float calculateZoomBarHeight()
+    // Read only keyframe, changes made by dragging are dropped
+    static void submitKeyframe(ImGuiNeoSequencerInternalData& context, const FrameIndexType* frame, uint32_t key)
     {
-        const auto& imStyle = GetStyle();
-        return GetFontSize() * style.ZoomHeightScale + imStyle.FramePadding.y * 2.0f;
+        FrameIndexType value = *frame;
+        submitKeyframe(context, &value, key);
     }
 
-    static void
-    processAndRenderZoom(ImGuiNeoSequencerInternalData& context, const ImVec2& cursor, bool allowEditingLength,
-                         FrameIndexType* start,
-                         FrameIndexType* end)
+    // Key of lane cache for current timeline, 0 when current timeline can't be cached this frame
+    static ImGuiID getLaneCacheKey(ImGuiNeoSequencerInternalData& context)
     {
-        const auto& imStyle = GetStyle();
-        ImGuiWindow* window = GetCurrentWindow();
+        if (!context.HasTimelineGeneration)
+            return 0;
 
-        const auto zoomHeight = calculateZoomBarHeight();
+        // Keyframes change looks on interaction, only untouched lanes are cached
+        if (context.StateOfSelection != SelectionState::Idle || context.StartDragging || context.DeleteDataDirty)
+            return 0;
+
+        const ImRect laneBB = {
+                ImVec2{context.StartValuesCursor.x - currentTimelineHeight, context.ValuesCursor.y},
+                ImVec2{context.StartValuesCursor.x + context.Size.x + currentTimelineHeight,
+                       context.ValuesCursor.y + currentTimelineHeight}
+        };
+
+        if (laneBB.Contains(GetMousePos()))
+            return 0;
+
+        struct
+        {
+            uint32_t Generation;
+            uint32_t SelectionVersion;
+            FrameIndexType StartFrame;
+            FrameIndexType EndFrame;
+            FrameIndexType OffsetFrame;
+            double Zoom;
+            float ValuesWidth;
+            float Width;
+            float Height;
+        } key;
+        memset(&key, 0, sizeof(key));
+        key.Generation = context.TimelineGeneration;
+        key.SelectionVersion = context.SelectionVersion;
+        key.StartFrame = context.StartFrame;
+        key.EndFrame = context.EndFrame;
+        key.OffsetFrame = context.OffsetFrame;
+        key.Zoom = context.Zoom;
+        key.ValuesWidth = context.ValuesWidth;
+        key.Width = context.Size.x;
+        key.Height = currentTimelineHeight;
+
+        ImGuiID hash = ImHashData(&key, sizeof(key), context.StyleHash);
+        if (!sequencerColorStack.empty())
+            hash = ImHashData(sequencerColorStack.Data, sequencerColorStack.size_in_bytes(), hash);
+
+        return hash != 0 ? hash : 1;
+    }
+
+    // Splices cached lane geometry into window draw list, returns false if cache is not valid for key
+    static bool drawLaneCache(ImGuiNeoLaneDrawCache& cache, ImGuiID key, ImGuiNeoSequencerInternalData& context)
+    {
+        if (cache.Key != key)
+            return false;
+
+        auto* drawList = GetWindowDrawList();
+        const auto& header = drawList->_CmdHeader;
+        if (memcmp(&cache.ClipRect, &header.ClipRect, sizeof(ImVec4)) != 0 || cache.TextureId != header.TextureId ||
+            cache.TexUvWhitePixel.x != drawList->_Data->TexUvWhitePixel.x ||
+            cache.TexUvWhitePixel.y != drawList->_Data->TexUvWhitePixel.y)
+            return false;
+
+        // Same frame hash as if keyframes were submitted
+        hashFrameData(context, cache.DataHash);
+
+        // Data didn't change since recording, so minimap lane already holds exactly these keyframes
+        if (context.MinimapLane)
+            context.MinimapLane->SeenCount = (uint32_t) context.MinimapLane->Keys.size();
+        const ImVec2 delta = context.ValuesCursor - cache.Origin;
+
+        drawList->PrimReserve(cache.Indices.size(), cache.Vertices.size());
+
+        const auto baseIdx = (ImDrawIdx) drawList->_VtxCurrentIdx;
+        for (const auto& vtx: cache.Vertices)
+        {
+            drawList->_VtxWritePtr->pos = vtx.pos + delta;
+            drawList->_VtxWritePtr->uv = vtx.uv;
+            drawList->_VtxWritePtr->col = vtx.col;
+            drawList->_VtxWritePtr++;
+        }
+        for (const auto idx: cache.Indices)
+        {
+            *drawList->_IdxWritePtr = (ImDrawIdx) (baseIdx + idx);
+            drawList->_IdxWritePtr++;
+        }
+        drawList->_VtxCurrentIdx += cache.Vertices.size();
+
+        return true;
+    }
+
+    // Keyframes of cacheable lane hash into lane hash, folded into frame hash as one value, so spliced lane hashes the same
+    static ImGuiID beginLaneHash(ImGuiNeoSequencerInternalData& context)
+    {
+        const ImGuiID frameHash = context.FrameDataHash;
+        context.FrameDataHash = 0;
+        return frameHash;
+    }
+
+    static ImGuiID endLaneHash(ImGuiNeoSequencerInternalData& context, ImGuiID frameHash)
+    {
+        const ImGuiID laneHash = context.FrameDataHash;
+        context.FrameDataHash = frameHash;
+        hashFrameData(context, laneHash);
+        return laneHash;
+    }
+
+    struct ImGuiNeoLaneRecording
+    {
+        int VtxStart;
+        int IdxStart;
+        int CmdCount;
+        unsigned int VtxCurrentIdx;
+        unsigned int VtxOffset;
+        ImGuiID FrameHash; // Frame hash before lane
+    };
+
+    static ImGuiNeoLaneRecording beginLaneRecording(ImGuiNeoSequencerInternalData& context)
+    {
+        const auto* drawList = GetWindowDrawList();
+        return {drawList->VtxBuffer.Size, drawList->IdxBuffer.Size, drawList->CmdBuffer.Size,
+                drawList->_VtxCurrentIdx, drawList->_CmdHeader.VtxOffset, beginLaneHash(context)};
+    }
+
+    static void endLaneRecording(const ImGuiNeoLaneRecording& recording, ImGuiNeoLaneDrawCache& cache, ImGuiID key,
+                                 ImGuiNeoSequencerInternalData& context)
+    {
+        const auto* drawList = GetWindowDrawList();
+        const ImGuiID laneHash = endLaneHash(context, recording.FrameHash);
+        const int vtxCount = drawList->VtxBuffer.Size - recording.VtxStart;
+        const int idxCount = drawList->IdxBuffer.Size - recording.IdxStart;
+
+        // Lane output has to be plain run of triangles in single command to be relocatable
+        if (drawList->CmdBuffer.Size != recording.CmdCount || drawList->_CmdHeader.VtxOffset != recording.VtxOffset ||
+            (sizeof(ImDrawIdx) == 2 && vtxCount > 0xFFFF))
+        {
+            cache.Key = 0;
+            return;
+        }
+
+        cache.Key = key;
+        cache.Origin = context.ValuesCursor;
+        cache.DataHash = laneHash;
+        cache.ClipRect = drawList->_CmdHeader.ClipRect;
+        cache.TextureId = drawList->_CmdHeader.TextureId;
+        cache.TexUvWhitePixel = drawList->_Data->TexUvWhitePixel;
+        cache.Vertices.resize(vtxCount);
+        if (vtxCount > 0)
+            memcpy(cache.Vertices.Data, drawList->VtxBuffer.Data + recording.VtxStart, (size_t) vtxCount * sizeof(ImDrawVert));
+        cache.Indices.resize(idxCount);
+        for (int i = 0; i < idxCount; i++)
+            cache.Indices[i] = (ImDrawIdx) (drawList->IdxBuffer[recording.IdxStart + i] - recording.VtxCurrentIdx);
+    }
+
+    static uint32_t idCounter = 0;
+
+    // Hashed from counter directly, no string formatting per item
+    static ImGuiID generateID()
+    {
+        return GetCurrentWindow()->GetID((int) idCounter++);
+    }
+
+    void resetID()
+    {
+        idCounter = 0;
+    }
+
+    static void renderCurrentFrame(ImGuiNeoSequencerInternalData& context)
+    {
+        const auto bb = getCurrentFrameBB(context.ScrubState == ImGuiNeoScrubState_InFlight ? context.RequestedFrame
+                                                                                           : context.CurrentFrame, context);
+
+        const auto drawList = ImGui::GetWindowDrawList();
+
+        RenderNeoSequencerCurrentFrame(
+                GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_FramePointerLine),
+                context.CurrentFrameColor,
+                bb,
+                context.Size.y - context.TopBarSize.y,
+                style.CurrentFrameLineWidth,
+                drawList
+        );
+    }
+
+    static float calculateZoomBarHeight()
+    {
+        const auto& imStyle = GetStyle();
+        return GetFontSize() * style.ZoomHeightScale + imStyle.FramePadding.y * 2.0f;
+    }
+
+    static void
+    processAndRenderZoom(ImGuiNeoSequencerInternalData& context, const ImVec2& cursor, bool allowEditingLength,
+                         bool showMinimap,
+                         FrameIndexType* start,
+                         FrameIndexType* end)
+    {
+        const auto& imStyle = GetStyle();
+        ImGuiWindow* window = GetCurrentWindow();
+
+        const auto zoomHeight = calculateZoomBarHeight();
 
         auto* drawList = GetWindowDrawList();
 
         //Input width
-        const auto inputWidth = CalcTextSize("123456").x;
+        const auto inputWidth = calcLabelSize("123456").x;
 
         const auto inputWidthWithPadding = inputWidth + imStyle.ItemSpacing.x;
 
@@ -549,7 +1546,56 @@ namespace ImGui
 
         const auto sliderHeight = bb.GetSize().y - imStyle.ItemInnerSpacing.y;
 
-        const auto sliderWidth = baseWidth / context.Zoom;
+        const auto totalFrames = (*end - *start);
+
+        if (showMinimap)
+        {
+            auto& buckets = context.MinimapBuckets;
+            const int bucketCount = ImMax((int) baseWidth, 1);
+
+            // Buckets are rebuilt only when bar is resized or sequence length changes
+            if (buckets.Size != bucketCount || context.MinimapStart != *start || context.MinimapEnd != *end)
+            {
+                buckets.resize(bucketCount);
+                memset(buckets.Data, 0, buckets.size_in_bytes());
+                context.MinimapStart = *start;
+                context.MinimapEnd = *end;
+                for (const auto& lane: context.MinimapLanes)
+                    for (const auto& key: lane.second.Keys)
+                        addMinimapBucket(context, key.second.Frame, 1);
+            }
+
+            uint32_t maxCount = 0;
+            for (const uint32_t count: buckets)
+                maxCount = ImMax(maxCount, count);
+
+            if (maxCount > 0)
+            {
+                const ImVec2 minimapMin = bb.Min + imStyle.ItemInnerSpacing / 2.0f;
+                const ImU32 minimapColor = ColorConvertFloat4ToU32(
+                        GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_ZoomBarMinimap));
+
+                for (int i = 0; i < buckets.Size; i++)
+                {
+                    if (buckets[i] == 0)
+                        continue;
+                    const float height = ImMax(sliderHeight * (float) buckets[i] / (float) maxCount, 1.0f);
+                    drawList->AddRectFilled({minimapMin.x + (float) i, minimapMin.y + sliderHeight - height},
+                                            {minimapMin.x + (float) i + 1.0f, minimapMin.y + sliderHeight},
+                                            minimapColor);
+                }
+            }
+        }
+
+        // Zoom in is limited to single visible frame
+        const double maxZoom = ImMax((double) totalFrames, 1.0);
+
+        context.Zoom = ImClamp(context.Zoom, 1.0, maxZoom);
+
+        if ((FrameIndexType) context.ViewOffset != context.OffsetFrame)
+            context.ViewOffset = (double) context.OffsetFrame;
+
+        const auto sliderWidth = (float) ((double) baseWidth / context.Zoom);
 
         const auto sliderMin = bb.Min + imStyle.ItemInnerSpacing / 2.0f;
 
@@ -557,13 +1603,12 @@ namespace ImGui
 
         const auto sliderMaxWidth = baseWidth;
 
-        const auto totalFrames = (*end - *start);
-
-        const auto singleFrameWidthOffset = sliderMaxWidth / (float) totalFrames;
+        // Double, float per frame width loses offsets of long sequences
+        const double singleFrameWidthOffset = (double) sliderMaxWidth / ImMax((double) totalFrames, 1.0);
 
-        const auto zoomSliderOffset = singleFrameWidthOffset * (float) context.OffsetFrame;
+        const double zoomSliderOffset = singleFrameWidthOffset * (double) context.OffsetFrame;
 
-        const auto sliderStart = sliderMin + ImVec2{zoomSliderOffset, 0};
+        const auto sliderStart = sliderMin + ImVec2{(float) zoomSliderOffset, 0};
 
         const float sideSize = sliderHeight;
 
@@ -573,8 +1618,6 @@ namespace ImGui
                                               finalSliderBB.Max - ImVec2{sideSize, 0}};
 
 
-        const auto viewWidth = (uint32_t) ((float) totalFrames / context.Zoom);
-
         const bool hovered = ItemHoverable(bb, GetCurrentWindow()->GetID("##zoom_slider"), ImGuiItemFlags_None);
 
         if (hovered)
@@ -582,43 +1625,59 @@ namespace ImGui
             SetKeyOwner(ImGuiKey_MouseWheelY, GetItemID());
             const float currentScroll = GetIO().MouseWheel;
 
-            context.Zoom = ImClamp(context.Zoom + float(currentScroll) * 0.3f, 1.0f, (float) viewWidth);
-            const auto newZoomWidth = (FrameIndexType) ceil((float) totalFrames / (context.Zoom));
+            if (currentScroll != 0.0f)
+            {
+                // Zoom is multiplied per wheel step, frame under mouse keeps its place in view
+                const double anchor = ImClamp((double) ((GetMousePos().x - finalSliderBB.Min.x) /
+                                                        ImMax(finalSliderBB.GetWidth(), 1.0f)), 0.0, 1.0);
+                const double anchorFrame = context.ViewOffset + anchor * ((double) totalFrames / context.Zoom);
+
+                // Long sequences use bigger factor, so whole range is always within zoomWheelRangeSteps
+                const double wheelFactor = ImMax((double) ImMax(style.ZoomWheelFactor, 1.0f),
+                                                 pow(maxZoom, 1.0 / zoomWheelRangeSteps));
+                context.Zoom = ImClamp(context.Zoom * pow(wheelFactor, (double) currentScroll), 1.0, maxZoom);
 
-            if (*start + context.OffsetFrame + newZoomWidth > *end)
-                context.OffsetFrame = ImMax(0U, totalFrames - viewWidth);
+                const double newViewFrames = (double) totalFrames / context.Zoom;
+
+                context.ViewOffset = ImClamp(anchorFrame - anchor * newViewFrames, 0.0,
+                                             ImMax((double) totalFrames - newViewFrames, 0.0));
+                context.OffsetFrame = (FrameIndexType) context.ViewOffset;
+            }
         }
 
+        const auto viewWidth = (uint32_t) ((double) totalFrames / context.Zoom);
+
         if (context.HoldingZoomSlider)
         {
             if (IsMouseDragging(ImGuiMouseButton_Left, 0.01f))
             {
                 const auto currentX = GetMousePos().x;
 
-                const auto v = currentX - bb.Min.x;// Subtract min
+                const double v = (double) (currentX - bb.Min.x);// Subtract min
 
-                const auto normalized = v / bb.GetWidth(); //Divide by width to remap to 0 - 1 range
+                const double normalized = v / (double) bb.GetWidth(); //Divide by width to remap to 0 - 1 range
 
-                const auto sliderWidthNormalized = 1.0f / context.Zoom;
+                const double sliderWidthNormalized = 1.0 / context.Zoom;
 
-                const auto singleFrameWidthOffsetNormalized = singleFrameWidthOffset / bb.GetWidth();
+                const double singleFrameWidthOffsetNormalized = singleFrameWidthOffset / (double) bb.GetWidth();
 
-                FrameIndexType finalFrame = (FrameIndexType) ((float) (normalized - sliderWidthNormalized / 2.0f) /
+                FrameIndexType finalFrame = (FrameIndexType) ((normalized - sliderWidthNormalized / 2.0) /
                                                               singleFrameWidthOffsetNormalized);
 
-                if (normalized - sliderWidthNormalized / 2.0f < 0.0f)
+                if (normalized - sliderWidthNormalized / 2.0 < 0.0)
                 {
                     finalFrame = 0;
                 }
 
 
-                if (normalized + sliderWidthNormalized / 2.0f > 1.0f)
+                if (normalized + sliderWidthNormalized / 2.0 > 1.0)
                 {
                     finalFrame = totalFrames - viewWidth;
                 }
 
 
                 context.OffsetFrame = finalFrame;
+                context.ViewOffset = (double) finalFrame;
             }
 
             if (!IsMouseDown(ImGuiMouseButton_Left))
@@ -645,6 +1704,7 @@ namespace ImGui
 
             if (IsItemHovered())
             {
+                context.HoveredItem = GetItemID();
                 sliderColor = GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_ZoomBarSliderHovered);
             }
 
@@ -653,13 +1713,19 @@ namespace ImGui
 
             const auto sliderCenter = finalSliderBB.GetCenter();
 
-            char overlayTextBuffer[128];
-
-            snprintf(overlayTextBuffer, sizeof(overlayTextBuffer), "%i - %i", viewStart, viewEnd);
-
-            const auto overlaySize = CalcTextSize(overlayTextBuffer);
+            if (context.ZoomOverlayText[0] == '\0' || context.ZoomOverlayStart != viewStart ||
+                context.ZoomOverlayEnd != viewEnd || context.ZoomOverlayFont != GetFont() ||
+                context.ZoomOverlayFontSize != GetFontSize())
+            {
+                ImFormatString(context.ZoomOverlayText, sizeof(context.ZoomOverlayText), "%i - %i", viewStart, viewEnd);
+                context.ZoomOverlaySize = CalcTextSize(context.ZoomOverlayText);
+                context.ZoomOverlayStart = viewStart;
+                context.ZoomOverlayEnd = viewEnd;
+                context.ZoomOverlayFont = GetFont();
+                context.ZoomOverlayFontSize = GetFontSize();
+            }
 
-            drawList->AddText(sliderCenter - overlaySize / 2.0f, IM_COL32_WHITE, overlayTextBuffer);
+            drawList->AddText(sliderCenter - context.ZoomOverlaySize / 2.0f, IM_COL32_WHITE, context.ZoomOverlayText);
         }
     }
 
@@ -672,9 +1738,21 @@ namespace ImGui
             context.StateOfSelection = SelectionState::Dragging;
             context.DraggingMouseStart = GetMousePos();
             context.StartDragging = false;
+            context.LastDragDelta = 0;
+            pushEvent(context, ImGuiNeoEventType_DragBegin, 0, 0, 0, 0);
             return;
         }
 
+        if (context.StateOfSelection == SelectionState::Dragging)
+        {
+            const FrameIndexType delta = getFrameDelta(context, GetMousePos().x - context.DraggingMouseStart.x);
+            if (delta != context.LastDragDelta)
+            {
+                context.LastDragDelta = delta;
+                pushEvent(context, ImGuiNeoEventType_DragUpdate, 0, 0, 0, delta);
+            }
+        }
+
         const auto windowWorkRect = GetCurrentWindow()->ClipRect;
 
         const auto sequencerWorkRect = ImRect{
@@ -721,12 +1799,16 @@ namespace ImGui
                 }
                 case SelectionState::Dragging:
                 {
+                    pushEvent(context, ImGuiNeoEventType_DragEnd, 0, 0, 0, context.LastDragDelta);
                     context.DraggingSelectionStart.resize(0);
                     context.StateOfSelection = SelectionState::Idle;
                     context.DraggingMouseStart = {0, 0};
                     context.DeleteDataDirty = true;
                     for (auto&& t: context.SelectionData)
+                    {
                         t.KeyframesToDelete.resize(0);
+                        t.SelectedKeys.resize(0);
+                    }
                     break;
                 }
             }
@@ -784,7 +1866,6 @@ namespace ImGui
     static bool groupBehaviour(const ImGuiID id, bool* open, const ImVec2 labelSize)
     {
         auto& context = sequencerData[currentSequencer];
-        ImGuiWindow* window = GetCurrentWindow();
 
         const bool closable = open != nullptr;
 
@@ -802,7 +1883,7 @@ namespace ImGui
                 groupBBMin,
                 groupBBMin + labelSize
         };
-        const ImGuiID arrowID = window->GetID(generateID());
+        const ImGuiID arrowID = generateID();
         const auto addArrowRes = ItemAdd(arrowBB, arrowID);
         if (addArrowRes)
         {
@@ -819,8 +1900,7 @@ namespace ImGui
                 context.SelectedTimeline = context.SelectedTimeline == id ? 0 : id;
             }
         }
-        const float width = groupBB.Max.x - arrowBB.Min.x;
-        context.ValuesWidth = std::max(context.ValuesWidth, width); // Make left panel wide enough
+        setLabelWidth(context, id, groupBB.Max.x - arrowBB.Min.x);
         return addGroupRes && addArrowRes;
     }
 
@@ -843,8 +1923,7 @@ namespace ImGui
                 context.SelectedTimeline = context.SelectedTimeline == id ? 0 : id;
             }
         }
-        const float width = groupBB.Max.x - groupBB.Min.x;
-        context.ValuesWidth = std::max(context.ValuesWidth, width); // Make left panel wide enough
+        setLabelWidth(context, id, groupBB.Max.x - groupBB.Min.x);
 
         return addGroupRes;
     }
@@ -869,9 +1948,15 @@ namespace ImGui
         IM_ASSERT(!inSequencer && "Called when while in other NeoSequencer, that won't work, call End!");
         IM_ASSERT(*startFrame < *endFrame && "Start frame must be smaller than end frame");
 
-        static char childNameStorage[64];
-        snprintf(childNameStorage, sizeof(childNameStorage), "##%s_child_wrapper", idin);
-        const bool openChild = BeginChild(childNameStorage);
+        const ImGuiID childId = GetID(idin);
+        auto childName = sequencerChildNames.find(childId);
+        if (childName == sequencerChildNames.end())
+        {
+            childName = sequencerChildNames.emplace(childId, ImGuiNeoChildName()).first;
+            ImFormatString(childName->second.Name, sizeof(childName->second.Name), "##%s_child_wrapper", idin);
+        }
+        childName->second.LastUsedFrame = GetFrameCount();
+        const bool openChild = BeginChild(childName->second.Name);
 
         if (!openChild)
         {
@@ -902,8 +1987,33 @@ namespace ImGui
 
         inSequencer = true;
 
+        collectUnusedSequencers();
+
         auto& context = sequencerData[id];
         context.Id = id;
+        context.LastUsedFrame = GetFrameCount();
+        updateValuesWidth(context);
+
+        if (context.Events.Size != ImMax(style.EventCapacity, 1))
+            context.Events.resize(ImMax(style.EventCapacity, 1));
+        context.EventHead = 0;
+        context.EventCount = 0;
+        context.DroppedEvents = 0;
+
+        context.DrawVtxStart = drawList->VtxBuffer.Size;
+        context.DrawIdxStart = drawList->IdxBuffer.Size;
+        context.DrawCmdStart = drawList->CmdBuffer.Size;
+        context.LaneCount = 0;
+        context.DegradedLanes = 0;
+
+        context.MinimapEnabled = (flags & ImGuiNeoSequencerFlags_ZoomBarMinimap) && !(flags & ImGuiNeoSequencerFlags_HideZoom);
+        context.MinimapFrame++;
+        context.MinimapLane = nullptr;
+        if (!context.MinimapEnabled && !context.MinimapLanes.empty())
+        {
+            context.MinimapLanes.clear();
+            context.MinimapBuckets.clear();
+        }
 
         auto realSize = ImFloor(size);
         if (realSize.x <= 0.0f)
@@ -916,6 +2026,7 @@ namespace ImGui
         context.SelectionEnabled = (flags & ImGuiNeoSequencerFlags_EnableSelection);
         context.DraggingEnabled = context.SelectionEnabled && (flags & ImGuiNeoSequencerFlags_Selection_EnableDragging);
         context.DeleteEnabled = context.SelectionEnabled && (flags & ImGuiNeoSequencerFlags_Selection_EnableDeletion);
+        context.CoalesceScrub = (flags & ImGuiNeoSequencerFlags_CoalesceScrub);
 
         context.TopLeftCursor = headerAlwaysVisible ? cursorBasePos : cursor;
 
@@ -926,11 +2037,25 @@ namespace ImGui
         context.StartFrame = *startFrame;
         context.EndFrame = *endFrame;
         context.Size = realSize;
+        context.FrameDataHash = 0;
+        context.HoveredItem = 0;
+
+        // Curve key drag ends on release, or when key stopped being submitted and lost active id
+        if (context.CurveDraggingID != 0 &&
+            (!IsMouseDown(ImGuiMouseButton_Left) || GetActiveID() != context.CurveDraggingID))
+            context.CurveDraggingID = 0;
 
         context.TopBarSize = ImVec2(context.Size.x, style.TopBarHeight);
 
         if (context.TopBarSize.y <= 0.0f)
-            context.TopBarSize.y = CalcTextSize("100").y + imStyle.FramePadding.y * 2.0f;
+            context.TopBarSize.y = calcLabelSize("100").y + imStyle.FramePadding.y * 2.0f;
+
+        {
+            const float fontSize = GetFontSize();
+            context.StyleHash = hashNeoStyle(style);
+            context.StyleHash = ImHashData(&imStyle.FramePadding, sizeof(imStyle.FramePadding), context.StyleHash);
+            context.StyleHash = ImHashData(&fontSize, sizeof(fontSize), context.StyleHash);
+        }
 
         currentSequencer = window->IDStack[window->IDStack.size() - 1];
 
@@ -955,7 +2080,9 @@ namespace ImGui
 
         if (showZoom)
             processAndRenderZoom(context, context.TopLeftCursor, flags & ImGuiNeoSequencerFlags_AllowLengthChanging,
-                                 startFrame, endFrame);
+                                 context.MinimapEnabled, startFrame, endFrame);
+
+        updateViewVelocity(context);
 
         if (context.Size.y < context.FilledHeight)
             context.Size.y = context.FilledHeight;
@@ -982,7 +2109,60 @@ namespace ImGui
         return true;
     }
 
-    void EndNeoSequencer()
+    // Hash of all state affecting what sequencer rendered this frame
+    static ImGuiID getOutputHash(ImGuiNeoSequencerInternalData& context)
+    {
+        const bool interacting = context.HoldingCurrentFrame || context.HoldingZoomSlider ||
+                                 context.StateOfSelection != SelectionState::Idle;
+        struct
+        {
+            float TopLeftCursor[2];
+            float Size[2];
+            FrameIndexType StartFrame;
+            FrameIndexType EndFrame;
+            FrameIndexType OffsetFrame;
+            FrameIndexType CurrentFrame;
+            double Zoom;
+            float ValuesWidth;
+            ImGuiID SelectedTimeline;
+            ImGuiID HoveredItem;
+            ImGuiID StyleHash;
+            ImGuiID ColorsHash;
+            uint32_t SelectionVersion;
+            float MousePos[2];
+            int StateOfSelection;
+            bool HoldingCurrentFrame;
+            bool HoldingZoomSlider;
+        } state;
+        memset(&state, 0, sizeof(state));
+        state.TopLeftCursor[0] = context.TopLeftCursor.x;
+        state.TopLeftCursor[1] = context.TopLeftCursor.y;
+        state.Size[0] = context.Size.x;
+        state.Size[1] = context.Size.y;
+        state.StartFrame = context.StartFrame;
+        state.EndFrame = context.EndFrame;
+        state.OffsetFrame = context.OffsetFrame;
+        state.CurrentFrame = context.CurrentFrame;
+        state.Zoom = context.Zoom;
+        state.ValuesWidth = context.ValuesWidth;
+        state.SelectedTimeline = context.SelectedTimeline;
+        state.HoveredItem = context.HoveredItem;
+        state.StyleHash = context.StyleHash;
+        state.ColorsHash = ImHashData(style.Colors, sizeof(style.Colors)); // Colors can be pushed inside sequencer
+        state.SelectionVersion = context.SelectionVersion;
+        if (interacting) // Selection rectangle and dragging follow mouse
+        {
+            state.MousePos[0] = GetMousePos().x;
+            state.MousePos[1] = GetMousePos().y;
+        }
+        state.StateOfSelection = (int) context.StateOfSelection;
+        state.HoldingCurrentFrame = context.HoldingCurrentFrame;
+        state.HoldingZoomSlider = context.HoldingZoomSlider;
+
+        return ImHashData(&state, sizeof(state), context.FrameDataHash);
+    }
+
+    bool EndNeoSequencer()
     {
         IM_ASSERT(inSequencer && "Called end sequencer when BeginSequencer didnt return true or wasn't called at all!");
         IM_ASSERT(sequencerData.count(currentSequencer) != 0 && "Ended sequencer has no context!");
@@ -993,9 +2173,22 @@ namespace ImGui
         if (context.SelectionEnabled)
             processSelection(context);
 
+        if (context.MinimapEnabled)
+            pruneMinimapLanes(context);
+
         context.LastSelectedTimeline = context.SelectedTimeline;
         context.IsSelectionRightClicked = false;
 
+        trimSelectionCapacity(context);
+
+        if (context.SelectionVersion != context.EventSelectionVersion)
+        {
+            context.EventSelectionVersion = context.SelectionVersion;
+            pushEvent(context, ImGuiNeoEventType_SelectionChanged, 0, 0, 0, 0);
+        }
+        context.LastHoveredKeyframe = context.HoveredKeyframe;
+        context.HoveredKeyframe = 0;
+
         if (context.SelectionEnabled)
             renderSelection(context);
 
@@ -1008,10 +2201,34 @@ namespace ImGui
         const auto max = context.Size;
 
         ItemSize({min, max});
+
+        // Everything emitted between Begin and End, lane caches included
+        const auto* drawList = GetWindowDrawList();
+        const int vtxCount = drawList->VtxBuffer.Size - context.DrawVtxStart;
+        const int idxCount = drawList->IdxBuffer.Size - context.DrawIdxStart;
+        context.DrawStats.VtxCount = (uint32_t) ImMax(vtxCount, 0);
+        context.DrawStats.IdxCount = (uint32_t) ImMax(idxCount, 0);
+        context.DrawStats.CmdCount = (uint32_t) ImMax(drawList->CmdBuffer.Size - context.DrawCmdStart, 0);
+        ImGuiID checksum = 0;
+        if (vtxCount > 0)
+            checksum = ImHashData(drawList->VtxBuffer.Data + context.DrawVtxStart, sizeof(ImDrawVert) * vtxCount, checksum);
+        if (idxCount > 0)
+            checksum = ImHashData(drawList->IdxBuffer.Data + context.DrawIdxStart, sizeof(ImDrawIdx) * idxCount, checksum);
+        context.DrawStats.Checksum = checksum;
+        context.DrawStats.DegradedLanes = context.DegradedLanes;
+        context.LastLaneCount = context.LaneCount;
+        lastEndedSequencer = currentSequencer;
+
+        const ImGuiID outputHash = getOutputHash(context);
+        const bool changed = outputHash != context.LastOutputHash;
+        context.LastOutputHash = outputHash;
+
         PopID();
         resetID();
 
         EndChild();
+
+        return changed;
     }
 
     IMGUI_API bool BeginNeoGroup(const char* label, bool* open)
@@ -1019,24 +2236,83 @@ namespace ImGui
         return BeginNeoTimeline(label, nullptr, 0, open, ImGuiNeoTimelineFlags_Group);
     }
 
-    IMGUI_API void EndNeoGroup()
+    IMGUI_API bool BeginNeoGroup(const char* label, bool* open, const ImGuiNeoGroupSummary* summary)
     {
-        return EndNeoTimeLine();
-    }
+        IM_ASSERT(open && "Summary is shown only for collapsible groups!");
 
-#ifdef __cplusplus
+        if (BeginNeoTimelineEx(label, open, ImGuiNeoTimelineFlags_Group))
+            return true;
 
-    bool
-    BeginNeoTimeline(const char* label, std::vector<int32_t>& keyframes, bool* open, ImGuiNeoTimelineFlags flags)
-    {
-        std::vector<int32_t*> c_keyframes{keyframes.size()};
-        for (uint32_t i = 0; i < keyframes.size(); i++)
-            c_keyframes[i] = &keyframes[i];
+        if (!summary || summary->Frames.empty())
+            return false;
+
+        auto& context = sequencerData[currentSequencer];
+        const auto& imStyle = GetStyle();
+        const NeoFrameRange view = NeoGetViewRange();
+        const int32_t* frames = summary->Frames.Data;
+        const int frameCount = summary->Frames.Size;
 
-        return BeginNeoTimeline(label, c_keyframes.data(), c_keyframes.size(), open, flags);
+        int lo = 0, hi = frameCount;
+        while (lo < hi)
+        {
+            const int mid = lo + (hi - lo) / 2;
+            if (frames[mid] < view.from) lo = mid + 1; else hi = mid;
+        }
+        const int first = lo;
+        hi = frameCount;
+        while (lo < hi)
+        {
+            const int mid = lo + (hi - lo) / 2;
+            if (frames[mid] <= view.to) lo = mid + 1; else hi = mid;
+        }
+        const int last = lo;
+
+        // Group already moved cursor below its lane
+        const float laneTop = context.ValuesCursor.y - currentTimelineHeight;
+        const float laneY = laneTop + currentTimelineHeight / 2.0f;
+        const float laneStart = context.StartValuesCursor.x + imStyle.FramePadding.x + context.ValuesWidth;
+        const float radius = currentTimelineHeight / 4.0f;
+        const ImU32 color = ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_Keyframe));
+        auto* drawList = GetWindowDrawList();
+
+        // Summary is drawn at most once per pixel, so lane width bounds it as well as visible frames
+        context.LaneCount++;
+        const uint32_t drawnBound = (uint32_t) ImMin(last - first, ImMax((int) getWorkTimelineWidth(context), 0) + 1);
+        const bool degraded = drawnBound * getKeyframeVertexCount(ImGuiNeoKeyframeShape_Diamond) > getLaneVertexShare(context);
+        if (degraded)
+            resetDensityBuffer(context);
+
+        // Keyframes closer than pixel are drawn once
+        float lastX = -FLT_MAX;
+        for (int i = first; i < last; i++)
+        {
+            const float offset = getKeyframePositionX(frames[i], context);
+            hashFrameData(context, (uint32_t) frames[i]);
+            if (degraded)
+            {
+                addKeyframeDensity(context.DensityBuffer, offset);
+                continue;
+            }
+            const float x = laneStart + offset;
+            if (x - lastX < 1.0f)
+                continue;
+            lastX = x;
+            drawList->AddCircleFilled({x, laneY}, radius, color, 4);
+        }
+
+        if (degraded)
+        {
+            drawDensityStrip(context, context.DensityBuffer.Data, context.DensityBuffer.Size, laneTop);
+            context.DegradedLanes++;
+        }
+
+        return false;
     }
 
-#endif
+    IMGUI_API void EndNeoGroup()
+    {
+        return EndNeoTimeLine();
+    }
 
     void PushNeoSequencerStyleColor(ImGuiNeoSequencerCol idx, ImU32 col)
     {
@@ -1085,6 +2361,27 @@ namespace ImGui
         context.SelectedTimeline = timelineID;
     }
 
+    NeoDrawStats GetNeoSequencerDrawStats()
+    {
+        IM_ASSERT(!inSequencer && "Call after EndNeoSequencer!");
+        const auto it = sequencerData.find(lastEndedSequencer);
+        if (it == sequencerData.end())
+            return {0, 0, 0, 0, 0};
+        return it->second.DrawStats;
+    }
+
+    void SetNextNeoTimelineGeneration(uint32_t generation)
+    {
+        nextTimelineGeneration = generation;
+        hasNextTimelineGeneration = true;
+    }
+
+    void SetNextNeoTimelineKeyframeAttributes(const NeoKeyframeAttributes& attributes)
+    {
+        nextKeyframeAttributes = attributes;
+        hasNextKeyframeAttributes = true;
+    }
+
     bool IsNeoTimelineSelected(ImGuiNeoTimelineIsSelectedFlags flags)
     {
         IM_ASSERT(inSequencer && "Not in active sequencer!");
@@ -1115,7 +2412,7 @@ namespace ImGui
         const auto& imStyle = GetStyle();
         ImGuiWindow* window = GetCurrentWindow();
         const ImGuiID id = window->GetID(label);
-        auto labelSize = CalcTextSize(label);
+        auto labelSize = calcLabelSize(label);
 
         labelSize.y += imStyle.FramePadding.y * 2 + style.ItemSpacing.y * 2;
         labelSize.x += imStyle.FramePadding.x * 2 + style.ItemSpacing.x * 2 +
@@ -1152,7 +2449,11 @@ namespace ImGui
                               selected?GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_SelectedTimeline):GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_TimelinesBg));
 
             ImVec4 color = GetStyleColorVec4(ImGuiCol_Text);
-            if (IsItemHovered()) color.w *= 0.7f;
+            if (IsItemHovered())
+            {
+                context.HoveredItem = id;
+                color.w *= 0.7f;
+            }
 
             RenderNeoTimelineLabel(label,
                                    context.ValuesCursor + imStyle.FramePadding +
@@ -1165,7 +2466,20 @@ namespace ImGui
         }
 
         if (result)
+        {
             context.TimelineStack.push_back(id);
+            context.KeyframeCounterStack.push_back(context.KeyframeCounter);
+            context.KeyframeCounter = 0;
+            context.LaneCount++;
+
+            if (context.MinimapEnabled)
+            {
+                context.MinimapLane = &context.MinimapLanes[id];
+                context.MinimapLane->SeenCount = 0;
+                context.MinimapLane->LastSubmitted = context.MinimapFrame;
+                context.MinimapLane->Complete = true;
+            }
+        }
 
         if (isGroup)
         { // Group requires special behaviour if its closed
@@ -1178,129 +2492,430 @@ namespace ImGui
         }
 
         keyframeDuplicates.resize(0);
+        context.TimelineGeneration = nextTimelineGeneration;
+        context.HasTimelineGeneration = hasNextTimelineGeneration;
+        hasNextTimelineGeneration = false;
+        context.KeyframeAttributes = nextKeyframeAttributes;
+        context.HasKeyframeAttributes = hasNextKeyframeAttributes && result;
+        context.KeyframeAttributeIndex = -1;
+        hasNextKeyframeAttributes = false;
+
+        hashFrameData(context, id);
+        hashFrameData(context, result);
+        if (context.HasTimelineGeneration)
+            hashFrameData(context, context.TimelineGeneration);
 
         return result;
     }
 
-    bool BeginNeoTimeline(const char* label, FrameIndexType** keyframes, uint32_t keyframeCount, bool* open,
-                          ImGuiNeoTimelineFlags flags)
+    NeoViewParams NeoGetViewParams()
     {
-        if (!BeginNeoTimelineEx(label, open, flags))
-            return false;
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        const auto& imStyle = GetStyle();
 
-        for (uint32_t i = 0; i < keyframeCount; i++)
-        {
-            NeoKeyframe(keyframes[i]);
-        }
+        const NeoFrameRange range = NeoGetViewRange();
 
-        return true;
+        NeoViewParams params;
+        params.ViewFrom = range.from;
+        params.ViewTo = range.to;
+        params.OriginFrame = context.StartFrame + context.OffsetFrame;
+        params.PerFrameWidth = getPerFrameWidth(context);
+        params.Width = context.Size.x - context.ValuesWidth - imStyle.FramePadding.x;
+        return params;
     }
 
-    void EndNeoTimeLine()
+    struct ImGuiNeoPrepareJob
     {
-        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        const NeoViewParams* View;
+        NeoPreparedTimeline* Timelines;
+    };
 
-        auto& context = sequencerData[currentSequencer];
-        const auto& imStyle = GetStyle();
+    // Runs on worker threads, mustn't touch ImGui context
+    static void prepareTimeline(void* userData, uint32_t item)
+    {
+        const auto& job = *(ImGuiNeoPrepareJob*) userData;
+        const NeoViewParams& view = *job.View;
+        NeoPreparedTimeline& timeline = job.Timelines[item];
 
-        IM_ASSERT(context.TimelineStack.size() > 0 && "Timeline stack push/pop missmatch!");
+        const FrameIndexType* keys = timeline.Keyframes;
+        const uint32_t count = timeline.KeyframeCount;
 
-        context.ValuesCursor.x += imStyle.FramePadding.x + (float) currentTimelineDepth * style.DepthItemSpacing;
-        context.ValuesCursor.y += currentTimelineHeight;
+        uint32_t lo = 0, hi = count;
+        while (lo < hi)
+        {
+            const uint32_t mid = lo + (hi - lo) / 2;
+            if (keys[mid] < view.ViewFrom) lo = mid + 1; else hi = mid;
+        }
+        timeline.VisibleFrom = lo;
+        hi = count;
+        while (lo < hi)
+        {
+            const uint32_t mid = lo + (hi - lo) / 2;
+            if (keys[mid] <= view.ViewTo) lo = mid + 1; else hi = mid;
+        }
+        timeline.VisibleTo = lo;
 
-        finishPreviousTimeline(context);
+        const uint32_t visible = timeline.VisibleTo - timeline.VisibleFrom;
+        const int buckets = ImMax((int) view.Width, 1);
 
-        if (!context.TimelineStack.empty() && !context.GroupStack.empty() &&
-            context.TimelineStack.back() == context.GroupStack.back())
+        timeline.PositionsX.resize(0);
+        timeline.Density.resize(0);
+
+        if (visible > (uint32_t) buckets)
         {
-            currentTimelineDepth--;
-            context.GroupStack.pop_back();
+            // More keys than pixels, only amount of keys per pixel is kept
+            timeline.Density.resize(buckets, 0);
+            for (uint32_t i = timeline.VisibleFrom; i < timeline.VisibleTo; i++)
+            {
+                const int bucket = (int) ((float) (keys[i] - view.OriginFrame) * view.PerFrameWidth);
+                timeline.Density[ImClamp(bucket, 0, buckets - 1)]++;
+            }
+            return;
         }
 
-        context.TimelineStack.pop_back();
+        timeline.PositionsX.resize(visible);
+        for (uint32_t i = 0; i < visible; i++)
+            timeline.PositionsX[i] = (float) (keys[timeline.VisibleFrom + i] - view.OriginFrame) * view.PerFrameWidth;
     }
 
-    void NeoKeyframe(int32_t* value)
+    void NeoPrepareTimelines(const NeoViewParams& view, NeoPreparedTimeline* timelines, uint32_t timelineCount,
+                             uint32_t threadCount)
     {
-        IM_ASSERT(inSequencer && "Not in active sequencer!");
-        auto& context = sequencerData[currentSequencer];
-        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+        if (threadCount == 0)
+            threadCount = ImMax(std::thread::hardware_concurrency(), 1u);
+
+        ImGuiNeoPrepareJob job = {&view, timelines};
+
+        if (threadCount == 1 || timelineCount <= 1)
+        {
+            for (uint32_t i = 0; i < timelineCount; i++)
+                prepareTimeline(&job, i);
+            return;
+        }
 
-        createKeyframe(value);
+        workerPool.Run(prepareTimeline, &job, timelineCount, threadCount);
     }
 
-    void NeoActiveZoneHandle(int32_t* frame, const ImVec4& bbData){
-        IM_ASSERT(inSequencer && "Not in active sequencer!");
+    bool BeginNeoTimeline(const char* label, NeoPreparedTimeline& timeline, bool* open, ImGuiNeoTimelineFlags flags)
+    {
+        if (!BeginNeoTimelineEx(label, open, flags))
+            return false;
+
         auto& context = sequencerData[currentSequencer];
-        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
 
-        const ImRect bb { bbData };
-        static bool hovered, held;
-        static void* dragging = nullptr;
-        static ImVec2 dragStart = {0,0};
-        static int32_t dragStartValue = 0;
-        const auto drawList = ImGui::GetWindowDrawList();
-        const ImGuiID id = GetCurrentWindow()->GetID((const void*)frame);
-        if (ItemAdd(bb, id)){
-            bool pressed = ButtonBehavior(bb, id, &hovered, &held);
-            drawList->AddRectFilled(bb.Min, bb.Max, ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(hovered?ImGuiNeoSequencerCol_ZoomBarSliderEndsHovered:ImGuiNeoSequencerCol_ZoomBarSliderEnds)));
-            if(pressed || held){
-                // Cancel selection
-                context.StateOfSelection = SelectionState::Idle;
-                context.StartDragging = false;
+        // Dragging and rebuild of selection data need every keyframe, not just visible ones
+        if (context.StateOfSelection == SelectionState::Dragging || context.StartDragging || context.DeleteDataDirty)
+        {
+            for (uint32_t i = 0; i < timeline.KeyframeCount; i++)
+                submitKeyframe(context, &timeline.Keyframes[i], i);
+            return true;
+        }
+
+        // Culled keyframes stay in minimap
+        if (context.MinimapLane)
+            context.MinimapLane->Complete = false;
+
+        if (!timeline.Density.empty())
+        {
+            drawDensityStrip(context, timeline.Density.data(), (int) timeline.Density.size(), context.ValuesCursor.y);
+            return true;
+        }
+
+        const uint32_t vertexShare = getLaneVertexShare(context);
+        uint64_t vertices = 0;
+        if (vertexShare != UINT32_MAX)
+        {
+            for (uint32_t i = timeline.VisibleFrom; i < timeline.VisibleTo && vertices <= vertexShare; i++)
+                vertices += getKeyframeVertexCount(context, (int) i);
+        }
+
+        if (vertices > vertexShare)
+        {
+            auto& density = resetDensityBuffer(context);
+            for (uint32_t i = timeline.VisibleFrom; i < timeline.VisibleTo; i++)
+                addKeyframeDensity(density, timeline.PositionsX[i - timeline.VisibleFrom]);
+            drawDensityStrip(context, density.Data, density.Size, context.ValuesCursor.y);
+            context.DegradedLanes++;
+            return true;
+        }
+
+        for (uint32_t i = timeline.VisibleFrom; i < timeline.VisibleTo; i++)
+        {
+            context.KeyframeCounter++;
+            context.KeyframeAttributeIndex = (int) i;
+            createKeyframe(&timeline.Keyframes[i], i, timeline.PositionsX[i - timeline.VisibleFrom]);
+        }
+        context.KeyframeAttributeIndex = -1;
+
+        return true;
+    }
+
+    // Timeline over keyframe array, keyframe(i) returns pointer to frame of i-th keyframe (pointer to const for read only)
+    template<typename KeyframeGetter>
+    static bool beginKeyframeTimeline(const char* label, uint32_t keyframeCount, bool* open, ImGuiNeoTimelineFlags flags,
+                                      KeyframeGetter keyframe)
+    {
+        if (!BeginNeoTimelineEx(label, open, flags))
+            return false;
+
+        auto& context = sequencerData[currentSequencer];
+
+        const bool editing = context.StateOfSelection == SelectionState::Dragging || context.StartDragging ||
+                             context.DeleteDataDirty;
+
+        // Sorted keyframes are culled to view, keyframe right outside of view is kept as it can still overlap it
+        uint32_t first = 0;
+        uint32_t last = keyframeCount;
+        if ((flags & ImGuiNeoTimelineFlags_SortedKeyframes) && !editing)
+        {
+            const NeoFrameRange view = NeoGetViewRange();
+            const auto lowerBound = [&](FrameIndexType frame) {
+                uint32_t lo = 0, hi = keyframeCount;
+                while (lo < hi)
+                {
+                    const uint32_t mid = lo + (hi - lo) / 2;
+                    if (*keyframe(mid) < frame) lo = mid + 1; else hi = mid;
+                }
+                return lo;
+            };
+            first = lowerBound(view.from - 1);
+            last = lowerBound(view.to + 2);
+
+            if (context.MinimapLane && (first > 0 || last < keyframeCount))
+                context.MinimapLane->Complete = false;
+        }
+
+        // Lane over its vertex share is drawn as density strip, all keyframes are still submitted while editing.
+        // Unsorted keyframes aren't culled, so only ones createKeyframe() draws are counted
+        const uint32_t vertexShare = editing ? UINT32_MAX : getLaneVertexShare(context);
+        uint64_t vertices = 0;
+        if (vertexShare != UINT32_MAX)
+        {
+            for (uint32_t i = first; i < last && vertices <= vertexShare; i++)
+            {
+                if (isKeyframeDrawn(context, getKeyframePositionX(*keyframe(i), context)))
+                    vertices += getKeyframeVertexCount(context, (int) i);
+            }
+        }
+
+        if (vertices > vertexShare)
+        {
+            if (context.MinimapLane)
+                context.MinimapLane->Complete = false;
+
+            auto& density = resetDensityBuffer(context);
+            for (uint32_t i = first; i < last; i++)
+                addKeyframeDensity(density, getKeyframePositionX(*keyframe(i), context));
+            drawDensityStrip(context, density.Data, density.Size, context.ValuesCursor.y);
+            context.DegradedLanes++;
+            return true;
+        }
+
+        const ImGuiID cacheKey = getLaneCacheKey(context);
+
+        if (cacheKey == 0)
+        {
+            const ImGuiID frameHash = beginLaneHash(context);
+            for (uint32_t i = first; i < last; i++)
+                submitKeyframe(context, keyframe(i), i);
+            endLaneHash(context, frameHash);
+            return true;
+        }
+
+        auto& cache = context.LaneCaches[context.TimelineStack.back()];
+        cache.LastUsedFrame = GetFrameCount();
+        if (drawLaneCache(cache, cacheKey, context))
+            return true;
+
+        const auto recording = beginLaneRecording(context);
+        for (uint32_t i = first; i < last; i++)
+            submitKeyframe(context, keyframe(i), i);
+        endLaneRecording(recording, cache, cacheKey, context);
+
+        return true;
+    }
+
+    bool BeginNeoTimeline(const char* label, FrameIndexType** keyframes, uint32_t keyframeCount, bool* open,
+                          ImGuiNeoTimelineFlags flags)
+    {
+        return beginKeyframeTimeline(label, keyframeCount, open, flags,
+                                     [keyframes](uint32_t i) { return keyframes[i]; });
+    }
+
+#ifdef __cplusplus
+
+    bool
+    BeginNeoTimeline(const char* label, std::vector<int32_t>& keyframes, bool* open, ImGuiNeoTimelineFlags flags)
+    {
+        // Keyframes are accessed in place, no pointer array is built
+        return beginKeyframeTimeline(label, (uint32_t) keyframes.size(), open, flags,
+                                     [&keyframes](uint32_t i) { return &keyframes[i]; });
+    }
+
+    bool BeginNeoTimelineStrided(const char* label, FrameIndexType* firstFrame, uint32_t keyframeCount, size_t stride,
+                                 bool* open, ImGuiNeoTimelineFlags flags)
+    {
+        auto* base = (char*) firstFrame;
+        return beginKeyframeTimeline(label, keyframeCount, open, flags,
+                                     [base, stride](uint32_t i) { return (FrameIndexType*) (base + i * stride); });
+    }
+
+    bool BeginNeoTimelineStrided(const char* label, const FrameIndexType* firstFrame, uint32_t keyframeCount,
+                                 size_t stride, bool* open, ImGuiNeoTimelineFlags flags)
+    {
+        const auto* base = (const char*) firstFrame;
+        return beginKeyframeTimeline(label, keyframeCount, open, flags,
+                                     [base, stride](uint32_t i) { return (const FrameIndexType*) (base + i * stride); });
+    }
+
+#endif
+
+    void EndNeoTimeLine()
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+
+        auto& context = sequencerData[currentSequencer];
+        const auto& imStyle = GetStyle();
+
+        IM_ASSERT(context.TimelineStack.size() > 0 && "Timeline stack push/pop missmatch!");
+
+        context.ValuesCursor.x += imStyle.FramePadding.x + (float) currentTimelineDepth * style.DepthItemSpacing;
+        context.ValuesCursor.y += currentTimelineHeight;
+
+        finishPreviousTimeline(context);
+
+        if (!context.TimelineStack.empty() && !context.GroupStack.empty() &&
+            context.TimelineStack.back() == context.GroupStack.back())
+        {
+            currentTimelineDepth--;
+            context.GroupStack.pop_back();
+        }
+
+        if (context.MinimapLane)
+        {
+            sweepMinimapLane(context, *context.MinimapLane);
+            context.MinimapLane = nullptr;
+        }
+
+        context.TimelineStack.pop_back();
+        context.KeyframeCounter = context.KeyframeCounterStack.back();
+        context.KeyframeCounterStack.pop_back();
+
+        // Keyframes submitted after nested timeline belong to parent again
+        if (context.MinimapEnabled && !context.TimelineStack.empty())
+            context.MinimapLane = &context.MinimapLanes[context.TimelineStack.back()];
+    }
+
+    void NeoKeyframe(int32_t* value)
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+
+        createKeyframe(value, context.KeyframeCounter++, getKeyframePositionX(*value, context));
+    }
+
+    void NeoKeyframe(int32_t* value, ImGuiID key)
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+
+        context.KeyframeCounter++;
+        createKeyframe(value, key, getKeyframePositionX(*value, context));
+    }
+
+    static void activeZoneHandle(ImGuiID id, int32_t* frame, const ImVec4& bbData){
+        auto& context = sequencerData[currentSequencer];
+
+        const ImRect bb { bbData };
+        bool hovered, held;
+        const auto drawList = ImGui::GetWindowDrawList();
+        if (ItemAdd(bb, id)){
+            bool pressed = ButtonBehavior(bb, id, &hovered, &held);
+            if (hovered)
+                context.HoveredItem = id;
+            drawList->AddRectFilled(bb.Min, bb.Max, ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(hovered?ImGuiNeoSequencerCol_ZoomBarSliderEndsHovered:ImGuiNeoSequencerCol_ZoomBarSliderEnds)));
+            if(pressed || held){
+                // Cancel selection
+                context.StateOfSelection = SelectionState::Idle;
+                context.StartDragging = false;
 
                 // Start drag ?
-                if(dragging != frame){
-                    dragStart = ImGui::GetMousePos();
-                    dragging = frame;
-                    dragStartValue = *frame;
+                if(context.ZoneDraggingID != id){
+                    context.ZoneDragStart = ImGui::GetMousePos();
+                    context.ZoneDraggingID = id;
+                    context.ZoneDragStartValue[0] = *frame;
                 }
 
-                if(dragging == frame){
-                    int32_t diff = ImGui::GetMousePos().x - dragStart.x;
-                    auto offsetA = int32_t(
-                            (1.f/context.Zoom) * (diff / (context.Size.x / (float) context.EndFrame - (float) context.StartFrame)));
+                if(context.ZoneDraggingID == id){
+                    int32_t diff = ImGui::GetMousePos().x - context.ZoneDragStart.x;
+                    auto offsetA = getFrameDelta(context, (float) diff);
 
-                    *frame = dragStartValue + offsetA;
+                    *frame = context.ZoneDragStartValue[0] + offsetA;
                 }
             }
             if(ImGui::IsItemDeactivated()){
                 context.StateOfSelection = SelectionState::Idle;
                 context.StartDragging = false;
-                dragging = nullptr;
-                dragStartValue = 0;
+                context.ZoneDraggingID = 0;
+                context.ZoneDragStartValue[0] = 0;
             }
 
         }
     }
 
-    void NeoActiveZone(ImGuiID id, int32_t* from, int32_t* to){
+    void NeoActiveZoneHandle(int32_t* frame, const ImVec4& bbData){
         IM_ASSERT(inSequencer && "Not in active sequencer!");
         auto& context = sequencerData[currentSequencer];
         IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
 
+        activeZoneHandle(GetCurrentWindow()->GetID((const void*)frame), frame, bbData);
+    }
+
+    // Area of zone on current timeline lane, constrained to visible part of timeline
+    // Row is vertical sub-range of lane, [rowOffset, rowOffset + rowHeight] from top of lane
+    static ImRect getActiveZoneBB(ImGuiNeoSequencerInternalData& context, int32_t from, int32_t to, float rowOffset, float rowHeight){
+        const auto& imStyle = GetStyle();
+        const auto fromX = getKeyframePositionX(from, context);
+        const auto toX = getKeyframePositionX(to, context);
+        float valuesStart = context.StartValuesCursor.x + imStyle.FramePadding.x + context.ValuesWidth;
+        const float laneTop = context.ValuesCursor.y - currentTimelineHeight;
+        return {
+            ImVec2{valuesStart + ImMax(fromX, 0.f), laneTop + rowOffset},
+            ImVec2{valuesStart + ImMin(toX, context.Size.x - imStyle.FramePadding.x - context.ValuesWidth), laneTop + rowOffset + rowHeight }
+        };
+    }
+
+    static ImU32 getActiveZoneColor(){
+        return ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(ImGui::IsNeoTimelineSelected()?ImGuiNeoSequencerCol_SelectedTimeline:ImGuiNeoSequencerCol_TimelineActive));
+    }
+
+    static void activeZone(ImGuiNeoSequencerInternalData& context, ImGuiID id, int32_t* from, int32_t* to, float rowOffset, float rowHeight){
+        hashFrameData(context, id);
+
         // Constrain value to track
         if(*from < 0) *from = 0;
-        if(*to < 1) *from = 1;
+        if(*to < 1) *to = 1;
         if(*from > context.EndFrame-1) *from = context.EndFrame-1;
         if(*to > context.EndFrame) *to = context.EndFrame;
 
+        hashFrameData(context, (uint32_t) *from);
+        hashFrameData(context, (uint32_t) *to);
+
         // Project position in pixels
         const auto fromX = getKeyframePositionX(*from, context);
         const auto toX = getKeyframePositionX(*to, context);
 
         const auto& imStyle = GetStyle();
-        float valuesStart = context.StartValuesCursor.x + imStyle.FramePadding.x + context.ValuesWidth;
-        ImRect bb = {
-            ImVec2{valuesStart + ImMax(fromX, 0.f), context.ValuesCursor.y - currentTimelineHeight},
-            ImVec2{valuesStart + ImMin(toX, context.Size.x - imStyle.FramePadding.x - context.ValuesWidth), context.ValuesCursor.y }//+ currentTimelineHeight}
-        };
 
         // Constrain to visible timeline zone
+        const ImRect bb = getActiveZoneBB(context, *from, *to, rowOffset, rowHeight);
 
         // Draw normal
         const auto drawList = ImGui::GetWindowDrawList();
-        drawList->AddRectFilled(bb.Min, bb.Max, ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(ImGui::IsNeoTimelineSelected()?ImGuiNeoSequencerCol_SelectedTimeline:ImGuiNeoSequencerCol_TimelineActive)));
+        drawList->AddRectFilled(bb.Min, bb.Max, getActiveZoneColor());
 
         // Exit early if invisible item ? (doesn't this mess up interaction ?
         ImGui::SetNextItemAllowOverlap();
@@ -1309,10 +2924,10 @@ namespace ImGui
 
         if(ImGui::IsNeoTimelineSelected()){
             constexpr int handleSizeX = 15;
-            const int handleSizeY = currentTimelineHeight;//*.2f;
+            const int handleSizeY = rowHeight;//*.2f;
 
             // Draw range rect
-            const ImRect bbRange = { bb.Min , bb.Max-ImVec2(0,currentTimelineHeight-handleSizeY)};
+            const ImRect bbRange = { bb.Min , bb.Max-ImVec2(0,rowHeight-handleSizeY)};
             bool rangeHovered = true;//ItemHoverable(bbRange, id, ImGuiItemFlags_None);
             drawList->AddRectFilled(bbRange.Min, bbRange.Max, ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(rangeHovered?ImGuiNeoSequencerCol_KeyframeHovered:ImGuiNeoSequencerCol_Keyframe)));
 
@@ -1325,56 +2940,337 @@ namespace ImGui
 
                 // Draw Handles
                 if(fromX >= 0)
-                    NeoActiveZoneHandle(from, bbHandles[0]);
+                    activeZoneHandle(hashMix(id, 1), from, bbHandles[0]);
                 if(toX <= context.Size.x - imStyle.FramePadding.x - context.ValuesWidth)
-                    NeoActiveZoneHandle(to, bbHandles[1]);
+                    activeZoneHandle(hashMix(id, 2), to, bbHandles[1]);
 
                 // Drag zone ?
-                ImGuiID dragID = ImGui::GetCurrentWindow()->GetID((intptr_t)to + (intptr_t)from);
+                ImGuiID dragID = hashMix(id, 3);
                 const ImRect dragRect {
                     bbHandles[0].z, bbHandles[0].y, bbHandles[1].x, bbHandles[0].w,
                 };
-                static ImGuiID dragging = 0;
-                static ImVec2 dragStart = {0,0};
-                static int32_t dragStartValue[2] = {0,0};
                 if(ItemAdd(dragRect,dragID)){
                     //ImGui::GetForegroundDrawList()->AddRectFilled(dragRect.Min, dragRect.Max, IM_COL32(255,0,0,128));
-                    static bool hovered, held;
+                    bool hovered, held;
                     bool pressed = ButtonBehavior(dragRect, dragID, &hovered, &held);
+                    if (hovered)
+                        context.HoveredItem = dragID;
                     if(pressed || held){
                         // Cancel selection
                         context.StateOfSelection = SelectionState::Idle;
                         context.StartDragging = false;
 
                         // Start drag ?
-                        if(dragging != dragID){
-                            dragStart = ImGui::GetMousePos();
-                            dragging = dragID;
-                            dragStartValue[0] = *from;
-                            dragStartValue[1] = *to;
+                        if(context.ZoneDraggingID != dragID){
+                            context.ZoneDragStart = ImGui::GetMousePos();
+                            context.ZoneDraggingID = dragID;
+                            context.ZoneDragStartValue[0] = *from;
+                            context.ZoneDragStartValue[1] = *to;
                         }
 
-                        if(dragging == dragID){
-                            int32_t diff = ImGui::GetMousePos().x - dragStart.x;
-                            auto offsetA = int32_t(
-                                    (1.f/context.Zoom) * (diff / (context.Size.x / (float) context.EndFrame - (float) context.StartFrame)));
+                        if(context.ZoneDraggingID == dragID){
+                            int32_t diff = ImGui::GetMousePos().x - context.ZoneDragStart.x;
+                            auto offsetA = getFrameDelta(context, (float) diff);
 
-                            *from = dragStartValue[0] + offsetA;
-                            *to = dragStartValue[1] + offsetA;
+                            *from = context.ZoneDragStartValue[0] + offsetA;
+                            *to = context.ZoneDragStartValue[1] + offsetA;
                         }
                     }
                     if(ImGui::IsItemDeactivated()){
                         context.StateOfSelection = SelectionState::Idle;
                         context.StartDragging = false;
-                        dragging = 0;
-                        dragStartValue[0] = 0;
-                        dragStartValue[1] = 0;
+                        context.ZoneDraggingID = 0;
+                        context.ZoneDragStartValue[0] = 0;
+                        context.ZoneDragStartValue[1] = 0;
                     }
                 }
             }
         }
     }
 
+    void NeoActiveZone(ImGuiID id, int32_t* from, int32_t* to){
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+
+        activeZone(context, id, from, to, 0.0f, currentTimelineHeight);
+    }
+
+    static FrameIndexType buildZoneTree(ImGuiNeoZoneTree& tree, uint32_t lo, uint32_t hi){
+        if(lo >= hi)
+            return INT32_MIN;
+        const uint32_t mid = lo + (hi - lo) / 2;
+        auto& node = tree.Nodes[mid];
+        node.MaxTo = ImMax(node.To, ImMax(buildZoneTree(tree, lo, mid), buildZoneTree(tree, mid + 1, hi)));
+        return node.MaxTo;
+    }
+
+    // Refreshes subtree ends of nodes in [from, to] and their ancestors, other subtrees keep stored ends
+    static FrameIndexType updateZoneTreeEnds(ImGuiNeoZoneTree& tree, uint32_t lo, uint32_t hi, uint32_t from, uint32_t to){
+        if(lo >= hi)
+            return INT32_MIN;
+        const uint32_t mid = lo + (hi - lo) / 2;
+        auto& node = tree.Nodes[mid];
+        if(hi <= from || lo > to)
+            return node.MaxTo;
+        node.MaxTo = ImMax(node.To, ImMax(updateZoneTreeEnds(tree, lo, mid, from, to), updateZoneTreeEnds(tree, mid + 1, hi, from, to)));
+        return node.MaxTo;
+    }
+
+    static bool zoneNodeLess(const ImGuiNeoZoneTreeNode& a, const ImGuiNeoZoneTreeNode& b){
+        return a.From < b.From || (a.From == b.From && a.Index < b.Index);
+    }
+
+    static bool zoneRowEndGreater(const ImGuiNeoZoneRowEnd& a, const ImGuiNeoZoneRowEnd& b){
+        return a.To > b.To || (a.To == b.To && a.Row > b.Row);
+    }
+
+    // Assigns sub-rows to nodes from start on, O((n - start) log rows)
+    static void layoutZoneRows(ImGuiNeoZoneTree& tree, uint32_t start){
+        const uint32_t count = tree.Nodes.size();
+
+        // Greedy stacking depends only on earlier zones. Row ends before start are ends of last zone in each row
+        tree.RowEnds.resize(0);
+        uint32_t rowCount = start > 0 ? tree.Nodes[start - 1].RowCount : 0;
+        if(rowCount > 0){
+            tree.RowFound.resize((int) rowCount);
+            memset(tree.RowFound.Data, 0, tree.RowFound.size_in_bytes());
+            for(uint32_t i = start; i-- > 0 && (uint32_t) tree.RowEnds.size() < rowCount;){
+                const auto& node = tree.Nodes[i];
+                if(tree.RowFound[node.Row])
+                    continue;
+                tree.RowFound[node.Row] = true;
+                tree.RowEnds.push_back({node.To, node.Row});
+            }
+            std::make_heap(tree.RowEnds.begin(), tree.RowEnds.end(), zoneRowEndGreater);
+        }
+
+        // Zone goes to row which ended first, if it ended before zone starts
+        for(uint32_t i = start; i < count; i++){
+            auto& node = tree.Nodes[i];
+            if(!tree.RowEnds.empty() && tree.RowEnds.front().To <= node.From){
+                std::pop_heap(tree.RowEnds.begin(), tree.RowEnds.end(), zoneRowEndGreater);
+                tree.RowEnds.back().To = node.To;
+            }
+            else{
+                tree.RowEnds.push_back({node.To, rowCount++});
+            }
+            node.Row = tree.RowEnds.back().Row;
+            node.RowCount = rowCount;
+            std::push_heap(tree.RowEnds.begin(), tree.RowEnds.end(), zoneRowEndGreater);
+        }
+        tree.RowCount = ImMax(1u, rowCount);
+    }
+
+    // Returns tree of zones, rebuilt when zones changed since last call
+    static ImGuiNeoZoneTree& getZoneTree(ImGuiNeoSequencerInternalData& context, ImGuiID zonesID, const NeoFrameRange* zones, uint32_t zoneCount){
+        auto& tree = context.ZoneTrees[zonesID];
+        tree.LastUsedFrame = GetFrameCount();
+
+        // Timeline generation covers zones too, otherwise zones are hashed. Zones edited by NeoActiveZones() are patched
+        // into tree by updateZoneTree(), so generation doesn't have to change during drag
+        ImGuiID hash = context.HasTimelineGeneration ? hashMix(context.TimelineGeneration, zoneCount) :
+                       ImHashData(zones, (size_t) zoneCount * sizeof(NeoFrameRange), zoneCount);
+        if(hash == 0)
+            hash = 1;
+
+        if(tree.DataHash == hash && (uint32_t) tree.Nodes.size() == zoneCount)
+            return tree;
+
+        tree.DataHash = hash;
+        tree.Nodes.resize((int) zoneCount);
+        for(uint32_t i = 0; i < zoneCount; i++)
+            tree.Nodes[i] = {zones[i].from, zones[i].to, zones[i].to, i, 0, 0};
+
+        std::sort(tree.Nodes.begin(), tree.Nodes.end(), zoneNodeLess);
+
+        tree.Positions.resize((int) zoneCount);
+        for(uint32_t i = 0; i < zoneCount; i++)
+            tree.Positions[tree.Nodes[i].Index] = i;
+
+        buildZoneTree(tree, 0, zoneCount);
+        layoutZoneRows(tree, 0);
+
+        return tree;
+    }
+
+    // Patches zone edited by user into tree, node is moved to its new start order without full sort. Returns new position
+    static uint32_t updateZoneTreeNode(ImGuiNeoZoneTree& tree, uint32_t index, const NeoFrameRange& zone){
+        uint32_t pos = tree.Positions[index];
+        tree.Nodes[pos].From = zone.from;
+        tree.Nodes[pos].To = zone.to;
+
+        const uint32_t count = tree.Nodes.size();
+        while(pos > 0 && zoneNodeLess(tree.Nodes[pos], tree.Nodes[pos - 1])){
+            ImSwap(tree.Nodes[pos], tree.Nodes[pos - 1]);
+            tree.Positions[tree.Nodes[pos].Index] = pos;
+            pos--;
+        }
+        while(pos + 1 < count && zoneNodeLess(tree.Nodes[pos + 1], tree.Nodes[pos])){
+            ImSwap(tree.Nodes[pos], tree.Nodes[pos + 1]);
+            tree.Positions[tree.Nodes[pos].Index] = pos;
+            pos++;
+        }
+        tree.Positions[index] = pos;
+        return pos;
+    }
+
+    // Collects positions (in tree.Nodes) of zones overlapping [from, to], in start order
+    static void queryZoneTree(const ImGuiNeoZoneTree& tree, uint32_t lo, uint32_t hi, FrameIndexType from, FrameIndexType to, ImVector<uint32_t>& out){
+        if(lo >= hi)
+            return;
+        const uint32_t mid = lo + (hi - lo) / 2;
+        const auto& node = tree.Nodes[mid];
+        if(node.MaxTo < from)
+            return;
+        queryZoneTree(tree, lo, mid, from, to, out);
+        if(node.From > to)
+            return;
+        if(node.To >= from)
+            out.push_back(mid);
+        queryZoneTree(tree, mid + 1, hi, from, to, out);
+    }
+
+    void NeoActiveZones(const char* id, NeoFrameRange* zones, uint32_t zoneCount, ImGuiNeoActiveZonesFlags flags){
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+
+        const ImGuiID zonesID = GetCurrentWindow()->GetID(id);
+        const NeoFrameRange view = NeoGetViewRange();
+        const bool sorted = flags & ImGuiNeoActiveZonesFlags_Sorted;
+        const bool stacked = flags & ImGuiNeoActiveZonesFlags_Stack;
+
+        // Candidates are either range of user array or positions in zone tree
+        uint32_t first = 0;
+        uint32_t last = zoneCount;
+        ImGuiNeoZoneTree* tree = nullptr;
+        if(stacked){
+            tree = &getZoneTree(context, zonesID, zones, zoneCount);
+            context.ZoneQueryBuffer.resize(0);
+            queryZoneTree(*tree, 0, zoneCount, view.from, view.to, context.ZoneQueryBuffer);
+            last = context.ZoneQueryBuffer.size();
+        }
+        else if(sorted){
+            // Sorted zones don't overlap so both ends are monotonic
+            uint32_t lo = 0, hi = zoneCount;
+            while(lo < hi){
+                const uint32_t mid = lo + (hi - lo) / 2;
+                if(zones[mid].to < view.from) lo = mid + 1; else hi = mid;
+            }
+            first = lo;
+            hi = zoneCount;
+            while(lo < hi){
+                const uint32_t mid = lo + (hi - lo) / 2;
+                if(zones[mid].from <= view.to) lo = mid + 1; else hi = mid;
+            }
+            last = lo;
+        }
+
+        const uint32_t rowCount = tree ? tree->RowCount : 1;
+        const float rowHeight = currentTimelineHeight / (float) rowCount;
+
+        // Zones narrower than a pixel are merged with their neighbours in the same row into single non-interactive rect
+        const float perFrameWidth = getPerFrameWidth(context);
+        const auto drawList = ImGui::GetWindowDrawList();
+        const ImU32 mergedColor = getActiveZoneColor();
+        context.ZoneMerges.resize((int) rowCount);
+        for(auto&& merge : context.ZoneMerges)
+            merge.Merging = false;
+
+        auto flushMerged = [&](uint32_t row){
+            auto& merge = context.ZoneMerges[row];
+            if(!merge.Merging)
+                return;
+            ImRect bb = getActiveZoneBB(context, merge.From, merge.To, (float) row * rowHeight, rowHeight);
+            bb.Max.x = ImMax(bb.Max.x, bb.Min.x + 1.0f);
+            drawList->AddRectFilled(bb.Min, bb.Max, mergedColor);
+            merge.Merging = false;
+        };
+
+        for(uint32_t i = first; i < last; i++){
+            uint32_t index = i;
+            uint32_t row = 0;
+            if(tree){
+                const auto& node = tree->Nodes[context.ZoneQueryBuffer[i]];
+                index = node.Index;
+                row = node.Row;
+            }
+
+            NeoFrameRange& zone = zones[index];
+            if(!tree && !sorted && (zone.to < view.from || zone.from > view.to))
+                continue;
+
+            auto& merge = context.ZoneMerges[row];
+            if((float)(zone.to - zone.from) * perFrameWidth < 1.0f){
+                hashFrameData(context, (uint32_t) zone.from);
+                hashFrameData(context, (uint32_t) zone.to);
+
+                if(merge.Merging && (float)(zone.from - merge.To) * perFrameWidth < 1.0f){
+                    merge.To = ImMax(merge.To, zone.to);
+                    continue;
+                }
+                flushMerged(row);
+                merge.Merging = true;
+                merge.From = zone.from;
+                merge.To = zone.to;
+                continue;
+            }
+
+            flushMerged(row);
+            const NeoFrameRange before = zone;
+            activeZone(context, getKeyframeID(zonesID, index), &zone.from, &zone.to, (float) row * rowHeight, rowHeight);
+
+            // Tree is updated after loop, as moving nodes would invalidate query positions
+            if(tree && (zone.from != before.from || zone.to != before.to)){
+                context.ZoneEdits.push_back(index);
+            }
+        }
+        for(uint32_t row = 0; row < rowCount; row++)
+            flushMerged(row);
+
+        if(!context.ZoneEdits.empty()){
+            // Only nodes between old and new positions of edited zones moved
+            uint32_t changedFrom = zoneCount, changedTo = 0;
+            for(auto&& index : context.ZoneEdits){
+                const uint32_t oldPos = tree->Positions[index];
+                const uint32_t newPos = updateZoneTreeNode(*tree, index, zones[index]);
+                changedFrom = ImMin(changedFrom, ImMin(oldPos, newPos));
+                changedTo = ImMax(changedTo, ImMax(oldPos, newPos));
+            }
+            updateZoneTreeEnds(*tree, 0, zoneCount, changedFrom, changedTo);
+            layoutZoneRows(*tree, changedFrom);
+            context.ZoneEdits.resize(0);
+
+            if(!context.HasTimelineGeneration)
+                tree->DataHash = ImMax(ImHashData(zones, (size_t) zoneCount * sizeof(NeoFrameRange), zoneCount), 1u);
+        }
+    }
+
+    uint32_t NeoQueryActiveZones(const char* id, FrameIndexType from, FrameIndexType to, uint32_t* indices, uint32_t indicesCount, uint32_t* rows){
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+
+        const ImGuiID zonesID = GetCurrentWindow()->GetID(id);
+        const auto it = context.ZoneTrees.find(zonesID);
+        if(it == context.ZoneTrees.end())
+            return 0;
+
+        const auto& tree = it->second;
+        context.ZoneQueryBuffer.resize(0);
+        queryZoneTree(tree, 0, tree.Nodes.size(), from, to, context.ZoneQueryBuffer);
+
+        const uint32_t found = context.ZoneQueryBuffer.size();
+        for(uint32_t i = 0; i < found && i < indicesCount; i++){
+            const auto& node = tree.Nodes[context.ZoneQueryBuffer[i]];
+            indices[i] = node.Index;
+            if(rows)
+                rows[i] = node.Row;
+        }
+        return found;
+    }
+
     bool IsNeoKeyframeHovered()
     {
         IM_ASSERT(inSequencer && "Not in active sequencer!");
@@ -1405,7 +3301,8 @@ namespace ImGui
         auto& context = sequencerData[currentSequencer];
 
         context.Selection.resize(0);
-        context.SelectionData.resize(0);
+        clearSelectionData(context);
+        context.SelectionVersion++;
     }
 
     bool NeoIsSelecting()
@@ -1432,40 +3329,123 @@ namespace ImGui
         return context.StateOfSelection == SelectionState::Dragging;
     }
 
-    uint32_t GetNeoKeyframeSelectionSize()
+    // Sequencer in scope, or last ended one when called after EndNeoSequencer()
+    static ImGuiNeoSequencerInternalData* getSelectionContext()
     {
-        IM_ASSERT(inSequencer && "Not in active sequencer!");
-        auto& context = sequencerData[currentSequencer];
+        const auto it = sequencerData.find(inSequencer ? currentSequencer : lastEndedSequencer);
+        return it != sequencerData.end() ? &it->second : nullptr;
+    }
 
-        if (!context.DeleteEnabled)
-            return 0;
+    uint32_t GetNeoSelectionTimelineCount()
+    {
+        const auto* context = getSelectionContext();
+        return context ? (uint32_t) context->SelectionData.size() : 0;
+    }
 
-        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
-        const ImGuiID timelineId = context.TimelineStack.back();
+    NeoTimelineSelection GetNeoSelectionTimeline(uint32_t index)
+    {
+        auto* context = getSelectionContext();
+        IM_ASSERT(context && index < (uint32_t) context->SelectionData.size() && "Selection timeline index out of range!");
 
-        for (auto&& deleteSelection: context.SelectionData)
+        auto& data = context->SelectionData[(int) index];
+        if (!data.KeysSorted)
         {
-            if (deleteSelection.TimelineID == timelineId)
-                return deleteSelection.KeyframesToDelete.size();
+            std::sort(data.SelectedKeys.begin(), data.SelectedKeys.end());
+            data.SelectedKeys.resize((int) (std::unique(data.SelectedKeys.begin(), data.SelectedKeys.end()) -
+                                            data.SelectedKeys.begin()));
+            data.KeysSorted = true;
         }
 
-        return 0;
+        return {data.TimelineID, data.KeyframesToDelete.Data, (uint32_t) data.KeyframesToDelete.size(),
+                data.SelectedKeys.Data, (uint32_t) data.SelectedKeys.size()};
     }
 
-    void GetNeoKeyframeSelection(FrameIndexType * selection)
+    ImGuiNeoScrubState GetNeoScrubState(FrameIndexType* requestedFrame)
     {
-        IM_ASSERT(inSequencer && "Not in active sequencer!");
-        auto& context = sequencerData[currentSequencer];
+        const auto it = sequencerData.find(inSequencer ? currentSequencer : lastEndedSequencer);
+        if (it == sequencerData.end())
+            return ImGuiNeoScrubState_None;
+
+        if (requestedFrame)
+            *requestedFrame = it->second.ScrubState == ImGuiNeoScrubState_None ? it->second.CurrentFrame
+                                                                               : it->second.RequestedFrame;
+        return it->second.ScrubState;
+    }
 
-        if (!context.DeleteEnabled)
-            return;
+    ImGuiID GetNeoSequencerID()
+    {
+        return inSequencer ? currentSequencer : lastEndedSequencer;
+    }
 
-        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
-        const ImGuiID timelineId = context.TimelineStack.back();
+    bool NeoPollEvent(ImGuiID sequencerID, NeoEvent* event)
+    {
+        IM_ASSERT(!(inSequencer && sequencerID == currentSequencer) && "Call after EndNeoSequencer!");
+        const auto it = sequencerData.find(sequencerID);
+        if (it == sequencerData.end() || it->second.EventCount == 0)
+            return false;
 
-        for (auto&& deleteSelection: context.SelectionData)
-        {
-            if (deleteSelection.TimelineID == timelineId)
+        auto& context = it->second;
+        *event = context.Events[context.EventHead];
+        context.EventHead = (context.EventHead + 1) % context.Events.Size;
+        context.EventCount--;
+        return true;
+    }
+
+    bool NeoPollEvent(NeoEvent* event)
+    {
+        IM_ASSERT(!inSequencer && "Call after EndNeoSequencer!");
+        return NeoPollEvent(lastEndedSequencer, event);
+    }
+
+    uint32_t GetNeoDroppedEventCount(ImGuiID sequencerID)
+    {
+        const auto it = sequencerData.find(sequencerID);
+        return it == sequencerData.end() ? 0 : it->second.DroppedEvents;
+    }
+
+    ImGuiID GetNeoTimelineID()
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+
+        return context.TimelineStack.back();
+    }
+
+    uint32_t GetNeoKeyframeSelectionSize()
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+
+        if (!context.DeleteEnabled)
+            return 0;
+
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+        const ImGuiID timelineId = context.TimelineStack.back();
+
+        for (auto&& deleteSelection: context.SelectionData)
+        {
+            if (deleteSelection.TimelineID == timelineId)
+                return deleteSelection.KeyframesToDelete.size();
+        }
+
+        return 0;
+    }
+
+    void GetNeoKeyframeSelection(FrameIndexType * selection)
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+
+        if (!context.DeleteEnabled)
+            return;
+
+        IM_ASSERT(!context.TimelineStack.empty() && "Not in timeline!");
+        const ImGuiID timelineId = context.TimelineStack.back();
+
+        for (auto&& deleteSelection: context.SelectionData)
+        {
+            if (deleteSelection.TimelineID == timelineId)
             {
                 for (int32_t i = 0; i < deleteSelection.KeyframesToDelete.size(); i++)
                 {
@@ -1501,7 +3481,7 @@ namespace ImGui
         // This math comes from RenderNeoSequencerTopBarOverlay
         const int32_t viewEnd = context.EndFrame + context.OffsetFrame;
         const int32_t viewStart = context.StartFrame + context.OffsetFrame;
-        const auto count = (int32_t)((float)((viewEnd + 1) - viewStart) / context.Zoom);
+        const auto count = (int32_t)((double)((viewEnd + 1) - viewStart) / context.Zoom);
 
         return {
             viewStart,
@@ -1509,6 +3489,26 @@ namespace ImGui
         };
     }
 
+    NeoFrameRange NeoGetPredictedViewRange(float secondsAhead)
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+
+        const double totalFrames = (double) ((context.EndFrame + 1) - context.StartFrame);
+        const double t = (double) ImMax(secondsAhead, 0.0f);
+
+        const double width = ImClamp(context.LastViewWidth + context.ViewWidthVelocity * t, 1.0, ImMax(totalFrames, 1.0));
+        const double start = ImClamp(context.LastViewStart + context.ViewStartVelocity * t, (double) context.StartFrame,
+                                     ImMax((double) context.StartFrame + totalFrames - width, (double) context.StartFrame));
+
+        const auto viewStart = (FrameIndexType) start;
+
+        return {
+            viewStart,
+            viewStart + (FrameIndexType) ceil(width)
+        };
+    }
+
     // Same as ImPlotEx helpers
     struct ImGuiPlotArrayGetterData
     {
@@ -1567,6 +3567,15 @@ namespace ImGui
         int res_w = ImMin((int)frame_size.x, values_count) + -1;
         int item_count = values_count + -1;
 
+        // Plot over its vertex share is drawn with less segments
+        context.LaneCount++;
+        const uint32_t maxSegments = getLaneVertexShare(context) / plotLineVertexCount;
+        if (res_w > 0 && (uint32_t) res_w > maxSegments)
+        {
+            res_w = (int) ImMax(maxSegments, 1U);
+            context.DegradedLanes++;
+        }
+
         const ImU32 col_base = GetColorU32(ImGuiCol_PlotLines);
 
         const float t_step = 1.0f / (float)res_w;
@@ -1584,6 +3593,10 @@ namespace ImGui
             const float v1 = Plot_ArrayGetter(&data.Values, (v1_idx + 1) % values_count);
             const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
 
+            uint32_t v1Bits;
+            memcpy(&v1Bits, &v1, sizeof(v1Bits));
+            hashFrameData(context, v1Bits);
+
             ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
             ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, tp1);
 
@@ -1606,6 +3619,304 @@ namespace ImGui
         finishPreviousTimeline(context);
     }
 
+    static float evaluateCurveSegment(const NeoCurveKey& a, const NeoCurveKey& b, float t)
+    {
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+        const float length = (float) (b.Frame - a.Frame);
+        return (2.0f * t3 - 3.0f * t2 + 1.0f) * a.Value + (t3 - 2.0f * t2 + t) * length * a.OutTangent +
+               (-2.0f * t3 + 3.0f * t2) * b.Value + (t3 - t2) * length * b.InTangent;
+    }
+
+    // Flattens segment into points relative to lane. Amount of lines comes from curvature, chord of n lines deviates
+    // at most max|y''| / (8 n^2) pixels from cubic, pixel length of segment only caps it.
+    static void tessellateCurveSegment(const NeoCurveKey& a, const NeoCurveKey& b, ImGuiNeoSequencerInternalData& context,
+                                       const ImVec2& size, float scaleMin, float invScale, ImVector<ImVec2>& out)
+    {
+        const float x0 = getKeyframePositionX(a.Frame, context);
+        const float x1 = getKeyframePositionX(b.Frame, context);
+        const int maxCount = ImClamp((int) ceil((x1 - x0) / ImMax(style.CurveSegmentLength, 1.0f)), 1, 64);
+
+        // Second derivative of cubic is linear in t, its maximum is at one of ends
+        const float length = (float) (b.Frame - a.Frame);
+        const float d0 = 6.0f * (b.Value - a.Value) - length * (4.0f * a.OutTangent + 2.0f * b.InTangent);
+        const float d1 = -6.0f * (b.Value - a.Value) + length * (2.0f * a.OutTangent + 4.0f * b.InTangent);
+        const float curvature = ImMax(ImFabs(d0), ImFabs(d1)) * size.y * invScale;
+        const int count = ImClamp((int) ceil(sqrt(curvature / (8.0f * ImMax(style.CurveFlatness, 0.01f)))), 1, maxCount);
+
+        for (int i = 0; i < count; i++)
+        {
+            const float t = (float) i / (float) count;
+            const float v = evaluateCurveSegment(a, b, t);
+            out.push_back({x0 + (x1 - x0) * t, size.y * (1.0f - ImSaturate((v - scaleMin) * invScale))});
+        }
+    }
+
+    bool NeoTimelineCurve(const char* id, NeoCurveKey* keys, int keyCount, float scale_min, float scale_max, ImVec2 graph_size)
+    {
+        IM_ASSERT(inSequencer && "Not in active sequencer!");
+        auto& context = sequencerData[currentSequencer];
+        const ImGuiStyle& imStyle = GetStyle();
+        ImGuiWindow* window = GetCurrentWindow();
+
+        const bool hasGeneration = hasNextTimelineGeneration;
+        const uint32_t generation = nextTimelineGeneration;
+        hasNextTimelineGeneration = false;
+
+        if (window->SkipItems)
+            return false;
+
+        const ImGuiID curveID = window->GetID(id);
+        const ImVec2 valuesStart = {context.StartValuesCursor.x + imStyle.FramePadding.x + context.ValuesWidth,
+                                    context.ValuesCursor.y};
+        const ImRect frameBB = {ImVec2{context.StartValuesCursor.x + context.ValuesWidth, context.ValuesCursor.y},
+                                ImVec2{context.StartValuesCursor.x + context.Size.x, context.ValuesCursor.y + graph_size.y}};
+        const ImVec2 padding = {0, imStyle.FramePadding.y};
+        const ImVec2 innerMin = ImVec2{valuesStart.x, frameBB.Min.y} + padding;
+        const ImVec2 innerSize = ImVec2{frameBB.Max.x - valuesStart.x, frameBB.GetHeight()} - padding * 2.0f;
+        const float invScale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+
+        currentTimelineHeight = graph_size.y;
+        context.FilledHeight += currentTimelineHeight;
+        context.LastTimelineOpenned = false;
+
+        bool edited = false;
+
+        if (ItemAdd(frameBB, curveID, NULL, ImGuiItemFlags_NoNav))
+        {
+            ImDrawList* drawList = window->DrawList;
+
+            drawList->AddText(context.ValuesCursor + imStyle.FramePadding + ImVec2{(float) currentTimelineDepth * style.DepthItemSpacing, 0},
+                              GetColorU32(ImGuiCol_TextDisabled), id, FindRenderedTextEnd(id));
+
+            // Visible segments, including ones crossing view borders
+            const NeoFrameRange view = NeoGetViewRange();
+            int first = 0, last = keyCount;
+            {
+                int lo = 0, hi = keyCount;
+                while (lo < hi)
+                {
+                    const int mid = lo + (hi - lo) / 2;
+                    if (keys[mid].Frame < view.from) lo = mid + 1; else hi = mid;
+                }
+                first = ImMax(lo - 1, 0);
+                hi = keyCount;
+                while (lo < hi)
+                {
+                    const int mid = lo + (hi - lo) / 2;
+                    if (keys[mid].Frame <= view.to) lo = mid + 1; else hi = mid;
+                }
+                last = ImMin(lo + 1, keyCount);
+            }
+
+            const int pixelWidth = ImMax((int) innerSize.x, 1);
+            const bool envelope = last - first > pixelWidth;
+
+            struct
+            {
+                FrameIndexType StartFrame;
+                FrameIndexType EndFrame;
+                double Zoom;
+                float Width;
+                float Height;
+                float ScaleMin;
+                float ScaleMax;
+                float SegmentLength;
+                float Flatness;
+            } viewKey;
+            memset(&viewKey, 0, sizeof(viewKey));
+            viewKey.StartFrame = context.StartFrame;
+            viewKey.EndFrame = context.EndFrame;
+            viewKey.Zoom = context.Zoom;
+            viewKey.Width = innerSize.x;
+            viewKey.Height = innerSize.y;
+            viewKey.ScaleMin = scale_min;
+            viewKey.ScaleMax = scale_max;
+            viewKey.SegmentLength = style.CurveSegmentLength;
+            viewKey.Flatness = style.CurveFlatness;
+            ImGuiID viewHash = ImHashData(&viewKey, sizeof(viewKey));
+            if (viewHash == 0)
+                viewHash = 1;
+
+            auto& cache = context.CurveCaches[curveID];
+            cache.LastUsedFrame = GetFrameCount();
+            const bool viewValid = cache.ViewHash == viewHash && cache.Envelope == envelope;
+            const bool generationValid = hasGeneration && cache.HasGeneration && cache.Generation == generation;
+            const bool rangeValid = cache.FirstKey == first && cache.LastKey == last;
+
+            // Pan doesn't change tessellation, cached points are only shifted by frames panned since
+            const float perFrameWidth = getPerFrameWidth(context);
+            const float panShift = (float) (cache.OffsetFrame - context.OffsetFrame) * perFrameWidth;
+
+            hashFrameData(context, curveID);
+            if (hasGeneration)
+                hashFrameData(context, generation);
+
+            if (!(viewValid && generationValid && rangeValid) || context.CurveDraggingID != 0)
+            {
+                cache.NextPoints.resize(0);
+                cache.NextSegmentHashes.resize(0);
+                cache.NextSegmentStarts.resize(0);
+
+                if (envelope)
+                {
+                    // Min / max of keys per pixel column, bounded by lane width
+                    int column = -1;
+                    float minY = 0.0f, maxY = 0.0f;
+                    for (int i = first; i < last; i++)
+                    {
+                        const float x = getKeyframePositionX(keys[i].Frame, context);
+                        const float y = innerSize.y * (1.0f - ImSaturate((keys[i].Value - scale_min) * invScale));
+                        const int keyColumn = (int) x;
+                        if (!hasGeneration)
+                            hashFrameData(context, ImHashData(&keys[i], sizeof(NeoCurveKey)));
+                        if (keyColumn == column)
+                        {
+                            minY = ImMin(minY, y);
+                            maxY = ImMax(maxY, y);
+                            continue;
+                        }
+                        if (column >= 0)
+                        {
+                            cache.NextPoints.push_back({(float) column, minY});
+                            cache.NextPoints.push_back({(float) column, maxY});
+                        }
+                        column = keyColumn;
+                        minY = maxY = y;
+                    }
+                    if (column >= 0)
+                    {
+                        cache.NextPoints.push_back({(float) column, minY});
+                        cache.NextPoints.push_back({(float) column, maxY});
+                    }
+                } else
+                {
+                    // Segments with unchanged keys are copied from previous tessellation
+                    const int cachedSegments = cache.SegmentHashes.size();
+                    for (int i = first; i + 1 < last; i++)
+                    {
+                        const ImGuiID segmentHash = ImHashData(&keys[i], sizeof(NeoCurveKey) * 2);
+                        if (!hasGeneration)
+                            hashFrameData(context, segmentHash);
+
+                        cache.NextSegmentHashes.push_back(segmentHash);
+                        cache.NextSegmentStarts.push_back(cache.NextPoints.size());
+
+                        const int cachedIndex = i - cache.FirstKey;
+                        if (viewValid && !cache.Envelope && cachedIndex >= 0 && cachedIndex < cachedSegments &&
+                            cache.SegmentHashes[cachedIndex] == segmentHash)
+                        {
+                            const int from = cache.SegmentStarts[cachedIndex];
+                            const int to = cache.SegmentStarts[cachedIndex + 1];
+                            for (int p = from; p < to; p++)
+                                cache.NextPoints.push_back(cache.Points[p] + ImVec2{panShift, 0});
+                            continue;
+                        }
+
+                        tessellateCurveSegment(keys[i], keys[i + 1], context, innerSize, scale_min, invScale, cache.NextPoints);
+                    }
+                    cache.NextSegmentStarts.push_back(cache.NextPoints.size());
+
+                    // Closing point of last segment
+                    if (last - first >= 1)
+                    {
+                        const auto& key = keys[last - 1];
+                        cache.NextPoints.push_back({getKeyframePositionX(key.Frame, context),
+                                                    innerSize.y * (1.0f - ImSaturate((key.Value - scale_min) * invScale))});
+                    }
+                }
+
+                cache.Points.swap(cache.NextPoints);
+                cache.SegmentHashes.swap(cache.NextSegmentHashes);
+                cache.SegmentStarts.swap(cache.NextSegmentStarts);
+                cache.ViewHash = viewHash;
+                cache.Envelope = envelope;
+                cache.FirstKey = first;
+                cache.LastKey = last;
+                cache.OffsetFrame = context.OffsetFrame;
+                cache.Generation = generation;
+                cache.HasGeneration = hasGeneration;
+            }
+
+            // Translate to lane
+            drawList->PushClipRect(frameBB.Min, frameBB.Max, true);
+            const ImU32 lineColor = GetColorU32(ImGuiCol_PlotLines);
+            const ImVec2 origin = innerMin + ImVec2{(float) (cache.OffsetFrame - context.OffsetFrame) * perFrameWidth, 0};
+            context.CurvePoints.resize(cache.Points.size());
+            for (int i = 0; i < cache.Points.size(); i++)
+                context.CurvePoints[i] = cache.Points[i] + origin;
+
+            if (cache.Envelope)
+            {
+                for (int i = 0; i + 1 < context.CurvePoints.size(); i += 2)
+                    drawList->AddRectFilled(context.CurvePoints[i], context.CurvePoints[i + 1] + ImVec2{1.0f, 1.0f}, lineColor);
+            } else
+            {
+                drawList->AddPolyline(context.CurvePoints.Data, context.CurvePoints.size(), lineColor, 0, 1.0f);
+
+                // Key handles
+                const float keyRadius = ImMax(GetFontSize() / 4.0f, 2.0f);
+                for (int i = first; i < last; i++)
+                {
+                    auto& key = keys[i];
+                    const ImVec2 pos = innerMin + ImVec2{getKeyframePositionX(key.Frame, context),
+                                                         innerSize.y * (1.0f - ImSaturate((key.Value - scale_min) * invScale))};
+                    const ImRect bb = {pos - ImVec2{keyRadius, keyRadius}, pos + ImVec2{keyRadius, keyRadius}};
+                    const ImGuiID keyID = getKeyframeID(curveID, (uint32_t) i);
+
+                    bool hovered = false, held = false;
+                    if (ItemAdd(bb, keyID))
+                        ButtonBehavior(bb, keyID, &hovered, &held);
+                    if (hovered)
+                        context.HoveredItem = keyID;
+
+                    if (held)
+                    {
+                        if (context.CurveDraggingID != keyID)
+                        {
+                            context.CurveDraggingID = keyID;
+                            context.CurveDragStart = GetMousePos();
+                            context.CurveDragStartKey = key;
+                        }
+
+                        // Keys are kept sorted, key can move only between its neighbours
+                        const ImVec2 delta = GetMousePos() - context.CurveDragStart;
+                        FrameIndexType frame = context.CurveDragStartKey.Frame + getFrameDelta(context, delta.x);
+                        if (i > 0) frame = ImMax(frame, keys[i - 1].Frame + 1);
+                        if (i + 1 < keyCount) frame = ImMin(frame, keys[i + 1].Frame - 1);
+                        const float value = context.CurveDragStartKey.Value - delta.y * (scale_max - scale_min) / ImMax(innerSize.y, 1.0f);
+
+                        if (frame != key.Frame || value != key.Value)
+                        {
+                            key.Frame = frame;
+                            key.Value = value;
+                            edited = true;
+                        }
+
+                        // Cancel selection
+                        context.StateOfSelection = SelectionState::Idle;
+                        context.StartDragging = false;
+                    } else if (context.CurveDraggingID == keyID)
+                    {
+                        context.CurveDraggingID = 0;
+                    }
+
+                    drawList->AddCircleFilled(pos, keyRadius, ColorConvertFloat4ToU32(GetStyleNeoSequencerColorVec4(
+                            held ? ImGuiNeoSequencerCol_KeyframePressed : hovered ? ImGuiNeoSequencerCol_KeyframeHovered
+                                                                                 : ImGuiNeoSequencerCol_Keyframe)), 4);
+                }
+            }
+            drawList->PopClipRect();
+        }
+
+        // Udate cursor as in : endneotimeline
+        context.ValuesCursor.y += currentTimelineHeight;
+
+        finishPreviousTimeline(context);
+
+        return edited;
+    }
+
     // Opens a tooltip window in the previous timeline lane, at the current time.
     bool NeoBeginTimeCursorTooltip(const char* id, NeoTooltipPositionFlags _flags, float tooltipWidth){
         IM_ASSERT(inSequencer && "Not in active sequencer!");
@@ -1650,6 +3961,353 @@ namespace ImGui
         ImGui::EndTooltip();
     }
 
+    static int64_t getPlaybackClock(const ImGuiNeoPlayback* playback)
+    {
+        if (playback->Clock)
+            return playback->Clock(playback->ClockUserData);
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void anchorPlayback(ImGuiNeoPlayback* playback, double frame, int64_t now)
+    {
+        playback->Position = frame;
+        playback->AnchorFrame = frame;
+        playback->AnchorTime = now;
+        playback->AnchorRate = playback->Rate;
+        playback->AnchorFrameRate = playback->FrameRate;
+    }
+
+    static double getAnchoredPosition(const ImGuiNeoPlayback* playback, int64_t now)
+    {
+        const double elapsed = (double) (now - playback->AnchorTime) * 1e-9;
+        return playback->AnchorFrame + elapsed * playback->AnchorFrameRate * playback->AnchorRate;
+    }
+
+    void NeoPlaybackPlay(ImGuiNeoPlayback* playback)
+    {
+        if (playback->Playing)
+            return;
+
+        anchorPlayback(playback, playback->Position, getPlaybackClock(playback));
+        playback->Playing = true;
+    }
+
+    void NeoPlaybackPause(ImGuiNeoPlayback* playback)
+    {
+        playback->Playing = false;
+    }
+
+    void NeoPlaybackSeek(ImGuiNeoPlayback* playback, double frame)
+    {
+        anchorPlayback(playback, frame, getPlaybackClock(playback));
+    }
+
+    void NeoPlaybackStep(ImGuiNeoPlayback* playback, int32_t frames)
+    {
+        NeoPlaybackSeek(playback, floor(playback->Position) + (double) frames);
+    }
+
+    bool NeoPlaybackUpdate(ImGuiNeoPlayback* playback, FrameIndexType* frame, FrameIndexType startFrame,
+                           FrameIndexType endFrame)
+    {
+        IM_ASSERT(playback->FrameRate > 0.0 && "Playback frame rate must be positive!");
+
+        const int64_t now = getPlaybackClock(playback);
+
+        // Frame was changed from outside since last update, continue from there
+        if (*frame != playback->LastFrame)
+            anchorPlayback(playback, (double) *frame, now);
+
+        const bool customRange = playback->LoopEnd > playback->LoopStart;
+        const double rangeStart = customRange ? playback->LoopStart : startFrame;
+        const double rangeEnd = (customRange ? playback->LoopEnd : endFrame) + 1.0; // End frame is still played whole
+
+        if (playback->Playing)
+        {
+            // Speed changed, time played so far keeps old speed
+            if (playback->Rate != playback->AnchorRate || playback->FrameRate != playback->AnchorFrameRate)
+                anchorPlayback(playback, getAnchoredPosition(playback, now), now);
+
+            // Position is always derived from anchor, so error doesn't accumulate over frames
+            double position = getAnchoredPosition(playback, now);
+
+            if (position < rangeStart || position >= rangeEnd)
+            {
+                if (playback->Loop)
+                {
+                    const double length = rangeEnd - rangeStart;
+                    position = rangeStart + fmod(position - rangeStart, length);
+                    if (position < rangeStart)
+                        position += length;
+                    anchorPlayback(playback, position, now);
+                } else
+                {
+                    position = ImClamp(position, rangeStart, rangeEnd - 1.0);
+                    playback->Playing = false;
+                }
+            }
+            playback->Position = position;
+        }
+
+        const auto newFrame = (FrameIndexType) floor(playback->Position);
+        const bool changed = newFrame != *frame;
+        *frame = newFrame;
+        playback->LastFrame = newFrame;
+
+        return changed;
+    }
+
+    static void laneProviderMain(ImGuiNeoLaneProvider* provider)
+    {
+        std::vector<FrameIndexType> keyframes;
+        std::unique_lock<std::mutex> lock(provider->Mutex);
+        while (true)
+        {
+            provider->WakeUp.wait(lock, [&] { return provider->Quit || !provider->Requests.empty(); });
+            if (provider->Quit)
+                return;
+
+            const uint64_t key = provider->Requests.back();
+            provider->Requests.pop_back();
+
+            auto it = provider->Windows.find(key);
+            if (it == provider->Windows.end())
+                continue;
+            it->second.Requested = false;
+            if (it->second.State != ImGuiNeoLaneWindow::WindowState::Pending)
+                continue;
+
+            // Not requested recently, user scrolled away from it
+            if (provider->CurrentFrame - it->second.LastUsedFrame > 2)
+            {
+                provider->Windows.erase(it);
+                continue;
+            }
+
+            const auto laneID = (ImGuiID) (key >> 32);
+            const auto windowIndex = (int32_t) (uint32_t) key;
+            const FrameIndexType from = windowIndex * provider->WindowSize;
+
+            lock.unlock();
+            keyframes.clear();
+            const bool fetched = provider->Fetch(provider->UserData, laneID, from, from + provider->WindowSize, keyframes);
+            std::sort(keyframes.begin(), keyframes.end());
+
+            // Keyframe keys are window base + index, so window can't hold more keyframes than frames
+            IM_ASSERT(keyframes.size() <= (size_t) provider->WindowSize && "Fetch returned more keyframes than window has frames!");
+            if (keyframes.size() > (size_t) provider->WindowSize)
+                keyframes.resize((size_t) provider->WindowSize);
+            lock.lock();
+
+            it = provider->Windows.find(key);
+            if (it == provider->Windows.end())
+                continue; // Invalidated while fetching
+
+            auto& window = it->second;
+            if (!fetched)
+            {
+                window.State = ImGuiNeoLaneWindow::WindowState::Failed;
+                window.FailedFrame = provider->CurrentFrame;
+                continue;
+            }
+
+            window.State = ImGuiNeoLaneWindow::WindowState::Ready;
+            window.Keyframes.assign(keyframes.begin(), keyframes.end());
+            window.Memory = sizeof(ImGuiNeoLaneWindow) + window.Keyframes.capacity() * sizeof(FrameIndexType);
+            provider->MemoryUsed += window.Memory;
+            provider->Lru.push_front(key);
+            window.LruPosition = provider->Lru.begin();
+
+            // Evict least recently used windows over budget, keep at least the one just fetched. Windows submitted
+            // in current or previous frame are visible and pinned, budget is exceeded rather than dropping them.
+            while (provider->MemoryUsed > provider->MemoryBudget && provider->Lru.size() > 1)
+            {
+                const uint64_t evicted = provider->Lru.back();
+                auto evictedIt = provider->Windows.find(evicted);
+                if (provider->CurrentFrame - evictedIt->second.LastUsedFrame <= 1)
+                    break; // LRU is ordered by use, all remaining windows are pinned too
+                provider->Lru.pop_back();
+                provider->MemoryUsed -= evictedIt->second.Memory;
+                provider->Windows.erase(evictedIt);
+            }
+        }
+    }
+
+    ImGuiNeoLaneProvider* NeoCreateLaneProvider(NeoLaneFetchFunc fetch, void* userData, size_t memoryBudget,
+                                                FrameIndexType windowSize)
+    {
+        IM_ASSERT(fetch && "Fetch function is required!");
+        IM_ASSERT(windowSize > 0 && "Window size must be positive!");
+
+        auto* provider = new ImGuiNeoLaneProvider();
+        provider->Fetch = fetch;
+        provider->UserData = userData;
+        provider->MemoryBudget = memoryBudget;
+        provider->WindowSize = windowSize;
+        provider->Worker = std::thread(laneProviderMain, provider);
+        return provider;
+    }
+
+    void NeoDestroyLaneProvider(ImGuiNeoLaneProvider* provider)
+    {
+        {
+            std::lock_guard<std::mutex> lock(provider->Mutex);
+            provider->Quit = true;
+        }
+        provider->WakeUp.notify_all();
+        provider->Worker.join();
+        delete provider;
+    }
+
+    void NeoInvalidateLaneProvider(ImGuiNeoLaneProvider* provider, ImGuiID laneID)
+    {
+        std::lock_guard<std::mutex> lock(provider->Mutex);
+        for (auto it = provider->Windows.begin(); it != provider->Windows.end();)
+        {
+            if ((ImGuiID) (it->first >> 32) != laneID)
+            {
+                ++it;
+                continue;
+            }
+            if (it->second.State == ImGuiNeoLaneWindow::WindowState::Ready)
+            {
+                provider->MemoryUsed -= it->second.Memory;
+                provider->Lru.erase(it->second.LruPosition);
+            }
+            it = provider->Windows.erase(it);
+        }
+    }
+
+    static int32_t getLaneWindowIndex(FrameIndexType frame, FrameIndexType windowSize)
+    {
+        return frame >= 0 ? frame / windowSize : (frame - windowSize + 1) / windowSize;
+    }
+
+    bool BeginNeoTimelineProvided(const char* label, ImGuiNeoLaneProvider* provider, ImGuiID laneID, bool* open,
+                                  ImGuiNeoTimelineFlags flags)
+    {
+        if (!BeginNeoTimelineEx(label, open, flags))
+            return false;
+
+        auto& context = sequencerData[currentSequencer];
+        const auto& imStyle = GetStyle();
+        const NeoFrameRange view = NeoGetViewRange();
+        const int frameCount = GetFrameCount();
+        provider->CurrentFrame = frameCount;
+
+        // Only fetched windows in view are submitted
+        if (context.MinimapLane)
+            context.MinimapLane->Complete = false;
+
+        const int32_t firstWindow = getLaneWindowIndex(view.from, provider->WindowSize);
+        const int32_t lastWindow = getLaneWindowIndex(view.to, provider->WindowSize);
+        const float laneStart = context.StartValuesCursor.x + imStyle.FramePadding.x + context.ValuesWidth;
+        const ImU32 placeholderColor = ColorConvertFloat4ToU32(
+                GetStyleNeoSequencerColorVec4(ImGuiNeoSequencerCol_Keyframe) * ImVec4{1.0f, 1.0f, 1.0f, 0.25f});
+
+        bool requested = false;
+        context.ProvidedKeyframes.resize(0);
+        context.ProvidedPlaceholders.resize(0);
+        {
+            // Lock is only contended while worker publishes fetched window, visible keyframes are copied out
+            // and emitted after it's released
+            std::lock_guard<std::mutex> lock(provider->Mutex);
+
+            // Not ready windows aren't in LRU, ones not used for a while are released here
+            if (frameCount - provider->LastSweepFrame > laneWindowRetryFrames)
+            {
+                provider->LastSweepFrame = frameCount;
+                for (auto it = provider->Windows.begin(); it != provider->Windows.end();)
+                {
+                    if (it->second.State != ImGuiNeoLaneWindow::WindowState::Ready &&
+                        frameCount - it->second.LastUsedFrame > laneWindowRetryFrames)
+                        it = provider->Windows.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            for (int32_t windowIndex = firstWindow; windowIndex <= lastWindow; windowIndex++)
+            {
+                const uint64_t key = ((uint64_t) laneID << 32) | (uint32_t) windowIndex;
+                auto& window = provider->Windows[key];
+                window.LastUsedFrame = frameCount;
+
+                if (window.State == ImGuiNeoLaneWindow::WindowState::Failed &&
+                    frameCount - window.FailedFrame > laneWindowRetryFrames)
+                    window.State = ImGuiNeoLaneWindow::WindowState::Pending;
+
+                hashFrameData(context, hashMix((ImGuiID) windowIndex, (uint32_t) window.State));
+
+                if (window.State == ImGuiNeoLaneWindow::WindowState::Ready)
+                {
+                    provider->Lru.splice(provider->Lru.begin(), provider->Lru, window.LruPosition);
+
+                    const uint32_t keyBase = (uint32_t) windowIndex * (uint32_t) provider->WindowSize;
+                    for (uint32_t i = 0; i < (uint32_t) window.Keyframes.size(); i++)
+                    {
+                        const FrameIndexType frame = window.Keyframes[i];
+                        if (frame >= view.from && frame <= view.to)
+                            context.ProvidedKeyframes.push_back({frame, keyBase + i});
+                    }
+                    continue;
+                }
+
+                if (window.State == ImGuiNeoLaneWindow::WindowState::Pending)
+                {
+                    // New windows and windows dropped by worker because they weren't visible are requested again
+                    if (!window.Requested)
+                    {
+                        window.Requested = true;
+                        provider->Requests.push_back(key);
+                        requested = true;
+                    }
+                    context.ProvidedPlaceholders.push_back(windowIndex);
+                }
+            }
+        }
+
+        // Visible keyframes decide if lane fits into its vertex share
+        const bool degraded = (uint64_t) context.ProvidedKeyframes.size() * getKeyframeVertexCount(ImGuiNeoKeyframeShape_Diamond) >
+                              getLaneVertexShare(context);
+        if (degraded)
+            resetDensityBuffer(context);
+
+        for (auto&& keyframe : context.ProvidedKeyframes)
+        {
+            FrameIndexType frame = keyframe.Frame; // Read only, edits of copy are dropped
+            if (degraded)
+            {
+                addKeyframeDensity(context.DensityBuffer, getKeyframePositionX(frame, context));
+                continue;
+            }
+            context.KeyframeCounter++;
+            createKeyframe(&frame, keyframe.Key, getKeyframePositionX(frame, context));
+        }
+
+        for (auto&& windowIndex : context.ProvidedPlaceholders)
+        {
+            const FrameIndexType from = ImMax(windowIndex * provider->WindowSize, view.from);
+            const FrameIndexType to = ImMin((windowIndex + 1) * provider->WindowSize, view.to);
+            GetWindowDrawList()->AddRectFilled(
+                    {laneStart + getKeyframePositionX(from, context), context.ValuesCursor.y + currentTimelineHeight / 3.0f},
+                    {laneStart + getKeyframePositionX(to, context), context.ValuesCursor.y + currentTimelineHeight * 2.0f / 3.0f},
+                    placeholderColor);
+        }
+
+        if (requested)
+            provider->WakeUp.notify_one();
+
+        if (degraded)
+        {
+            drawDensityStrip(context, context.DensityBuffer.Data, context.DensityBuffer.Size, context.ValuesCursor.y);
+            context.DegradedLanes++;
+        }
+
+        return true;
+    }
+
     void NeoDrawTimelineRect(ImGui::FrameIndexType from, ImGui::FrameIndexType to, ImVec4 color, const bool inPrevLane){
         IM_ASSERT(inSequencer && "Not in active sequencer!");
         auto& context = sequencerData[currentSequencer];
@@ -1700,4 +4358,144 @@ ImGuiNeoSequencerStyle::ImGuiNeoSequencerStyle()
 
     Colors[ImGuiNeoSequencerCol_SelectionBorder] = ImVec4{0.98f, 0.706f, 0.322f, 0.61f};
     Colors[ImGuiNeoSequencerCol_Selection] = ImVec4{0.98f, 0.706f, 0.322f, 0.33f};
+
+    Colors[ImGuiNeoSequencerCol_ZoomBarMinimap] = ImVec4{0.35f, 0.35f, 0.35f, 0.90f};
+}
+
+void ImGuiNeoGroupSummary::Build(const ImGuiID* trackIDs, const int32_t* const* trackKeys, const uint32_t* trackCounts, uint32_t trackCount)
+{
+    Clear();
+
+    TrackIDs.assign(trackIDs, trackIDs + trackCount);
+    TrackKeys.resize(trackCount);
+    for (uint32_t t = 0; t < trackCount; t++)
+    {
+        TrackKeys[t].assign(trackKeys[t], trackKeys[t] + trackCounts[t]);
+        IM_ASSERT(TrackSlots.find(trackIDs[t]) == TrackSlots.end() && "Track ids have to be unique!");
+        TrackSlots[trackIDs[t]] = t;
+    }
+
+    // K-way merge, heap holds head of every track
+    struct Head { int32_t Frame; uint32_t Track; uint32_t Position; };
+    auto later = [](const Head& a, const Head& b) { return a.Frame > b.Frame; };
+    std::vector<Head> heap;
+    heap.reserve(trackCount);
+    for (uint32_t t = 0; t < trackCount; t++)
+        if (trackCounts[t] > 0)
+            heap.push_back({trackKeys[t][0], t, 0});
+    std::make_heap(heap.begin(), heap.end(), later);
+
+    while (!heap.empty())
+    {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        Head& head = heap.back();
+
+        if (!Frames.empty() && Frames.back() == head.Frame)
+            Counts.back()++;
+        else
+        {
+            Frames.push_back(head.Frame);
+            Counts.push_back(1);
+        }
+
+        // Duplicate keys of one track count once
+        const int32_t* keys = trackKeys[head.Track];
+        while (++head.Position < trackCounts[head.Track] && keys[head.Position] == head.Frame)
+            ;
+        if (head.Position < trackCounts[head.Track])
+        {
+            head.Frame = keys[head.Position];
+            std::push_heap(heap.begin(), heap.end(), later);
+        } else
+            heap.pop_back();
+    }
+}
+
+void ImGuiNeoGroupSummary::SetTrack(ImGuiID trackID, const int32_t* keys, uint32_t count)
+{
+    auto slot = TrackSlots.find(trackID);
+    if (slot == TrackSlots.end())
+    {
+        slot = TrackSlots.emplace(trackID, (uint32_t) TrackIDs.size()).first;
+        TrackIDs.push_back(trackID);
+        TrackKeys.emplace_back();
+    }
+    const size_t track = slot->second;
+
+    std::vector<int32_t>& oldKeys = TrackKeys[track];
+    if (oldKeys.size() == count && (count == 0 || memcmp(oldKeys.data(), keys, count * sizeof(int32_t)) == 0))
+        return;
+
+    // Single pass over union, old keys and new keys, counts of frames only in old keys go down, only in new keys go up
+    NextFrames.resize(0);
+    NextCounts.resize(0);
+    size_t u = 0, o = 0, n = 0;
+    const size_t unionSize = (size_t) Frames.Size;
+    while (u < unionSize || n < count)
+    {
+        const int32_t frame = ImMin(u < unionSize ? Frames[(int) u] : INT32_MAX, n < count ? keys[n] : INT32_MAX);
+        uint32_t frameCount = 0;
+        if (u < unionSize && Frames[(int) u] == frame)
+            frameCount = Counts[(int) u++];
+
+        bool inOld = false, inNew = false;
+        while (o < oldKeys.size() && oldKeys[o] < frame)
+            o++;
+        while (o < oldKeys.size() && oldKeys[o] == frame)
+        {
+            inOld = true;
+            o++;
+        }
+        while (n < count && keys[n] == frame)
+        {
+            inNew = true;
+            n++;
+        }
+
+        if (inOld && !inNew)
+            frameCount--;
+        if (inNew && !inOld)
+            frameCount++;
+
+        if (frameCount > 0)
+        {
+            NextFrames.push_back(frame);
+            NextCounts.push_back(frameCount);
+        }
+    }
+    Frames.swap(NextFrames);
+    Counts.swap(NextCounts);
+
+    oldKeys.assign(keys, keys + count);
+}
+
+void ImGuiNeoGroupSummary::RemoveTrack(ImGuiID trackID)
+{
+    const auto slot = TrackSlots.find(trackID);
+    if (slot == TrackSlots.end())
+        return;
+
+    SetTrack(trackID, nullptr, 0);
+
+    // Last track is moved into freed slot
+    const uint32_t track = slot->second;
+    const uint32_t lastTrack = (uint32_t) TrackIDs.size() - 1;
+    if (track != lastTrack)
+    {
+        TrackIDs[track] = TrackIDs[lastTrack];
+        TrackKeys[track].swap(TrackKeys[lastTrack]);
+        TrackSlots[TrackIDs[track]] = track;
+    }
+    TrackIDs.pop_back();
+    TrackKeys.pop_back();
+    TrackSlots.erase(slot);
+}
+
+void ImGuiNeoGroupSummary::Clear()
+{
+    Frames.resize(0);
+    Counts.resize(0);
+    TrackIDs.clear();
+    TrackKeys.clear();
+    TrackSlots.clear();
 }
@@ -6,6 +6,8 @@
 #define IMGUI_NEO_SEQUENCER_H
 
 #include "imgui.h"
+#include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 typedef int ImGuiNeoSequencerFlags;
@@ -13,6 +15,11 @@ typedef int ImGuiNeoSequencerCol;
 typedef int ImGuiNeoTimelineFlags;
 typedef int ImGuiNeoTimelineIsSelectedFlags;
 typedef int NeoTooltipPositionFlags;
+typedef int ImGuiNeoActiveZonesFlags;
+typedef int ImGuiNeoKeyframeShape;
+typedef int ImGuiNeoKeyframeFlags;
+typedef int ImGuiNeoEventType;
+typedef int ImGuiNeoScrubState;
 
 // Flags for ImGui::BeginNeoSequencer()
 enum ImGuiNeoSequencerFlags_
@@ -28,6 +35,9 @@ enum ImGuiNeoSequencerFlags_
     ImGuiNeoSequencerFlags_Selection_EnableDragging = 1 << 5,
     ImGuiNeoSequencerFlags_Selection_EnableDeletion = 1 << 6,
 
+    ImGuiNeoSequencerFlags_ZoomBarMinimap       = 1 << 7, // Shows keyframe density of whole sequence in zoom bar
+    ImGuiNeoSequencerFlags_CoalesceScrub        = 1 << 8, // While scrubbing, frame is written at most once per ImGuiNeoSequencerStyle::ScrubEvaluationBudget
+
 };
 
 // Flags for ImGui::BeginNeoTimeline()
@@ -36,6 +46,7 @@ enum ImGuiNeoTimelineFlags_
     ImGuiNeoTimelineFlags_None                 = 0     ,
     ImGuiNeoTimelineFlags_AllowFrameChanging   = 1 << 0,
     ImGuiNeoTimelineFlags_Group                = 1 << 1,
+    ImGuiNeoTimelineFlags_SortedKeyframes      = 1 << 2, // Keyframes are sorted by frame, only ones in view are submitted (all while dragging / deleting selection)
 };
 
 // Flags for ImGui::IsNeoTimelineSelected()
@@ -45,6 +56,53 @@ enum ImGuiNeoTimelineIsSelectedFlags_
     ImGuiNeoTimelineIsSelectedFlags_NewlySelected   = 1 << 0,
 };
 
+// Flags for ImGui::NeoActiveZones()
+enum ImGuiNeoActiveZonesFlags_
+{
+    ImGuiNeoActiveZonesFlags_None           = 0     ,
+    ImGuiNeoActiveZonesFlags_Sorted         = 1 << 0, // Zones are sorted by start and don't overlap, culled by binary search instead of linear scan
+    ImGuiNeoActiveZonesFlags_Stack          = 1 << 1, // Overlapping zones are stacked into sub-rows, zones are kept in interval tree which is rebuilt only when they change
+};
+
+// Glyph of keyframe, see ImGui::SetNextNeoTimelineKeyframeAttributes()
+enum ImGuiNeoKeyframeShape_
+{
+    ImGuiNeoKeyframeShape_Diamond           = 0,
+    ImGuiNeoKeyframeShape_Circle,
+    ImGuiNeoKeyframeShape_Square,
+    ImGuiNeoKeyframeShape_Triangle,
+};
+
+// Per keyframe flags, see ImGui::SetNextNeoTimelineKeyframeAttributes()
+enum ImGuiNeoKeyframeFlags_
+{
+    ImGuiNeoKeyframeFlags_None              = 0     ,
+    ImGuiNeoKeyframeFlags_Locked            = 1 << 0, // Keyframe can be selected, but is not moved by dragging selection
+    ImGuiNeoKeyframeFlags_Muted             = 1 << 1, // Keyframe is drawn faded
+};
+
+// State of current frame pointer, see ImGui::GetNeoScrubState()
+enum ImGuiNeoScrubState_
+{
+    ImGuiNeoScrubState_None                 = 0, // Pointer isn't dragged
+    ImGuiNeoScrubState_InFlight,                 // Pointer is dragged, frame can still change
+    ImGuiNeoScrubState_Settled,                  // Pointer was released this frame, frame is final
+};
+
+// Type of event returned by ImGui::NeoPollEvent()
+enum ImGuiNeoEventType_
+{
+    ImGuiNeoEventType_None                  = 0,
+    ImGuiNeoEventType_KeyframeHovered,          // Keyframe started being hovered
+    ImGuiNeoEventType_KeyframeClicked,
+    ImGuiNeoEventType_KeyframeRightClicked,
+    ImGuiNeoEventType_DragBegin,                // Dragging of selection started
+    ImGuiNeoEventType_DragUpdate,               // Delta = frames moved since drag begin, sent when it changes
+    ImGuiNeoEventType_DragEnd,                  // Delta = final frames moved
+    ImGuiNeoEventType_SelectionChanged,
+    ImGuiNeoEventType_CurrentFrameChanged,      // Frame = new current frame, Delta = change
+};
+
 enum ImGuiNeoSequencerCol_
 {
     ImGuiNeoSequencerCol_Bg,
@@ -71,6 +129,8 @@ enum ImGuiNeoSequencerCol_
     ImGuiNeoSequencerCol_SelectionBorder,
     ImGuiNeoSequencerCol_Selection,
 
+    ImGuiNeoSequencerCol_ZoomBarMinimap,
+
     ImGuiNeoSequencerCol_COUNT
 };
 
@@ -93,9 +153,16 @@ struct ImGuiNeoSequencerStyle {
     float       CurrentFramePointerSize = 7.0f;                 // Size of pointing arrow above current frame line
     float       CurrentFrameLineWidth   = 1.0f;                 // Width of line showing current frame over timeline
     float       ZoomHeightScale         = 1.0f;                 // Scale of Zoom bar, base height is font size
+    float       ZoomWheelFactor         = 2.0f;                 // Zoom is multiplied by this value per mouse wheel step, raised for long sequences so full zoom range takes at most 16 steps
     float       CollidedKeyframeOffset  = 3.5f;                 // Offset on which colliding keyframes are rendered
 
     float       MaxSizePerTick          = 4.0f;                 // Maximum amount of pixels per tick on timeline (if less pixels is present, ticks are not rendered)
+    float       CurveSegmentLength      = 4.0f;                 // Maximum length in pixels of single line when tessellating curve lanes
+    float       CurveFlatness           = 0.25f;                // Maximum distance in pixels between tessellated curve lane and exact curve, flat segments use fewer lines
+    int         UnusedContextFrames     = 3600;                 // State of sequencer not begun for this many frames is released (<= 0 = never)
+    float       ScrubEvaluationBudget   = 0.033f;               // Seconds between frame writes while scrubbing with ImGuiNeoSequencerFlags_CoalesceScrub, set to cost of scene evaluation
+    int         EventCapacity           = 256;                  // Events kept per sequencer frame, see NeoPollEvent()
+    uint32_t    VertexBudget            = 0;                    // Maximum vertices per sequencer (0 = unlimited), lanes exceeding their share of remaining budget are drawn as non editable density strip
 
     ImVec4      Colors[ImGuiNeoSequencerCol_COUNT];
 
@@ -105,6 +172,52 @@ struct ImGuiNeoSequencerStyle {
     ImGuiNeoSequencerStyle();
 };
 
+// Asynchronous cache of lazily fetched timeline keyframes, see ImGui::NeoCreateLaneProvider()
+struct ImGuiNeoLaneProvider;
+
+// Union of keyframes of group children, shown as summary lane of collapsed group, see ImGui::BeginNeoGroup().
+// Tracks are kept sorted and union is updated incrementally by merge of changed track only.
+// Summary of nested group can be used as track of its parent, so whole hierarchy doesn't need to be submitted.
+struct ImGuiNeoGroupSummary {
+    ImVector<int32_t>                   Frames;             // Sorted unique frames of all tracks
+    ImVector<uint32_t>                  Counts;             // Per frame amount of tracks with keyframe on it
+
+    // Internal
+    std::vector<ImGuiID>                TrackIDs;
+    std::vector<std::vector<int32_t>>   TrackKeys;          // Last keys of every track, used to find what changed
+    std::unordered_map<ImGuiID, uint32_t> TrackSlots;       // Index of track in TrackIDs and TrackKeys
+    ImVector<int32_t>                   NextFrames;         // Double buffers of merge
+    ImVector<uint32_t>                  NextCounts;
+
+    void    Build(const ImGuiID* trackIDs, const int32_t* const* trackKeys, const uint32_t* trackCounts, uint32_t trackCount); // Rebuilds from sorted tracks by k-way merge
+    void    SetTrack(ImGuiID trackID, const int32_t* keys, uint32_t count); // Sets sorted keys of track, only difference to previous keys is merged
+    void    RemoveTrack(ImGuiID trackID);
+    void    Clear();
+};
+
+// Playback state used by ImGui::NeoPlaybackUpdate(), frame position is driven by monotonic clock so it doesn't depend on UI frame rate
+// Monotonic clock in nanoseconds used by playback, see ImGuiNeoPlayback::Clock
+typedef int64_t (*ImGuiNeoPlaybackClockFunc)(void* userData);
+
+struct ImGuiNeoPlayback {
+    double      FrameRate               = 30.0;                 // Frames per second of played content
+    double      Rate                    = 1.0;                  // Playback speed multiplier, negative value plays backwards
+    bool        Loop                    = true;                 // Wrap around at end of played range, otherwise playback stops there
+    int32_t     LoopStart               = 0;                    // Played range, used when LoopEnd > LoopStart, otherwise whole sequence is played
+    int32_t     LoopEnd                 = 0;
+    ImGuiNeoPlaybackClockFunc Clock     = nullptr;              // Time source, nullptr = std::chrono::steady_clock (set own clock for tests or offline rendering)
+    void*       ClockUserData           = nullptr;
+
+    // Internal
+    bool        Playing                 = false;
+    double      Position                = 0.0;                  // Fractional frame position computed by last update
+    double      AnchorFrame             = 0.0;                  // Frame position at AnchorTime
+    int64_t     AnchorTime              = 0;                    // Monotonic clock time in nanoseconds
+    double      AnchorRate              = 1.0;                  // Rate and FrameRate since anchor, position is re-anchored when they change
+    double      AnchorFrameRate         = 30.0;
+    int32_t     LastFrame               = 0;                    // Frame written by last update, used to detect scrubbing
+};
+
 namespace ImGui {
     typedef int32_t FrameIndexType;
 
@@ -116,9 +229,14 @@ namespace ImGui {
     IMGUI_API void PopNeoSequencerStyleColor(int count = 1);
 
     IMGUI_API bool BeginNeoSequencer(const char* id, FrameIndexType * frame, FrameIndexType * startFrame, FrameIndexType * endFrame,const ImVec2& size = ImVec2(0, 0),ImGuiNeoSequencerFlags flags = ImGuiNeoSequencerFlags_None);
-    IMGUI_API void EndNeoSequencer(); //Call only when BeginNeoSequencer() returns true!!
+    IMGUI_API bool EndNeoSequencer(); //Call only when BeginNeoSequencer() returns true!! Returns true if output changed since last frame, use it to skip redraws of idle sequencer
+
+    // Geometry emitted by last ended sequencer, use it to track rendering cost (e.g. vertex budgets in regression tests)
+    struct NeoDrawStats { uint32_t VtxCount; uint32_t IdxCount; uint32_t CmdCount; ImGuiID Checksum; uint32_t DegradedLanes; }; // DegradedLanes = lanes simplified to fit ImGuiNeoSequencerStyle::VertexBudget
+    IMGUI_API NeoDrawStats GetNeoSequencerDrawStats(); // Call after EndNeoSequencer(), checksum is hash of emitted vertices and indices
 
     IMGUI_API bool BeginNeoGroup(const char* label, bool* open = nullptr);
+    IMGUI_API bool BeginNeoGroup(const char* label, bool* open, const ImGuiNeoGroupSummary* summary); // Draws summary keyframes in group lane while collapsed
     IMGUI_API void EndNeoGroup();
 
     IMGUI_API bool BeginNeoTimeline(const char* label,FrameIndexType ** keyframes, uint32_t keyframeCount, bool * open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
@@ -126,7 +244,8 @@ namespace ImGui {
 
     // Fully customizable timeline with per key callback
     IMGUI_API bool BeginNeoTimelineEx(const char* label, bool * open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
-    IMGUI_API void NeoKeyframe(int32_t* value);
+    IMGUI_API void NeoKeyframe(int32_t* value); // Keyframe identity is its order inside timeline
+    IMGUI_API void NeoKeyframe(int32_t* value, ImGuiID key); // Keyframe identity is user supplied stable key (index, handle...), unique per timeline
     IMGUI_API void NeoActiveZone(ImGuiID id, int32_t* from, int32_t* to);
     IMGUI_API void NeoActiveZoneHandle(int32_t* frame, const ImVec4& bb);
 
@@ -151,27 +270,208 @@ namespace ImGui {
     IMGUI_API void GetNeoKeyframeSelection(FrameIndexType  * selection);
 
 
+    // Selection of whole sequencer grouped by timeline, usable inside sequencer scope or after EndNeoSequencer() for last ended sequencer.
+    // Frames are read only and valid until sequencer is drawn again, timeline can have 0 selected frames left.
+    // Keys are sorted unique keys of selected keyframes, for bulk timelines and NeoKeyframe() without key they are keyframe indices.
+    struct NeoTimelineSelection { ImGuiID TimelineID; const FrameIndexType* Frames; uint32_t Count; const uint32_t* Keys; uint32_t KeyCount; };
+    IMGUI_API uint32_t GetNeoSelectionTimelineCount();
+    IMGUI_API NeoTimelineSelection GetNeoSelectionTimeline(uint32_t index);
+    IMGUI_API ImGuiID GetNeoTimelineID(); // ID of current timeline, matches NeoTimelineSelection::TimelineID
+
+    // Events of sequencer's last frame, drain them after its EndNeoSequencer() instead of polling every keyframe.
+    // Buffer of style.EventCapacity events is kept per sequencer and cleared on its next BeginNeoSequencer(),
+    // oldest events are dropped when it's full. Keyframe events have TimelineID, Key and Frame of keyframe set.
+    struct NeoEvent { ImGuiNeoEventType Type; ImGuiID TimelineID; uint32_t Key; FrameIndexType Frame; FrameIndexType Delta; };
+    IMGUI_API ImGuiID GetNeoSequencerID(); // ID of sequencer in scope or last ended one, store it to poll its events later
+    IMGUI_API bool NeoPollEvent(ImGuiID sequencerID, NeoEvent* event);
+    IMGUI_API bool NeoPollEvent(NeoEvent* event); // Events of last ended sequencer
+    IMGUI_API uint32_t GetNeoDroppedEventCount(ImGuiID sequencerID); // Events dropped in sequencer's last frame because buffer was full
+
+    // Scrub state of sequencer in scope or last ended one. requestedFrame receives newest frame under pointer,
+    // which can be ahead of written frame while scrub is coalesced. Background evaluator should always target it.
+    IMGUI_API ImGuiNeoScrubState GetNeoScrubState(FrameIndexType* requestedFrame = nullptr);
+
+    // Bulk edits of user keyframes by indices (NeoTimelineSelection::Keys), each is single stable O(n) pass.
+    // Unsorted indices are sorted into temporary copy first, duplicate and out of range indices are ignored.
+    // Call NeoClearSelection() after erase or duplicate, as indices of keyframes change.
+    inline const uint32_t* NeoSortedIndices(const uint32_t* indices, uint32_t indexCount, std::vector<uint32_t>& scratch)
+    {
+        if (std::is_sorted(indices, indices + indexCount))
+            return indices;
+        scratch.assign(indices, indices + indexCount);
+        std::sort(scratch.begin(), scratch.end());
+        return scratch.data();
+    }
+
+    template<typename T>
+    void NeoEraseIndices(std::vector<T>& keyframes, const uint32_t* indices, uint32_t indexCount)
+    {
+        std::vector<uint32_t> scratch;
+        indices = NeoSortedIndices(indices, indexCount, scratch);
+
+        size_t write = 0;
+        uint32_t next = 0;
+        for (size_t read = 0; read < keyframes.size(); read++)
+        {
+            while (next < indexCount && indices[next] < read) next++;
+            if (next < indexCount && indices[next] == read) continue;
+            if (write != read) keyframes[write] = std::move(keyframes[read]);
+            write++;
+        }
+        keyframes.resize(write);
+    }
+
+    // Inserts copy right after every indexed keyframe
+    template<typename T>
+    void NeoDuplicateIndices(std::vector<T>& keyframes, const uint32_t* indices, uint32_t indexCount)
+    {
+        std::vector<uint32_t> scratch;
+        indices = NeoSortedIndices(indices, indexCount, scratch);
+
+        uint32_t validCount = 0;
+        size_t copyCount = 0;
+        for (; validCount < indexCount && indices[validCount] < keyframes.size(); validCount++)
+            if (validCount == 0 || indices[validCount] != indices[validCount - 1]) copyCount++;
+        if (copyCount == 0) return;
+
+        const size_t oldSize = keyframes.size();
+        keyframes.resize(oldSize + copyCount);
+
+        // Moves from back, every keyframe is moved at most once. Keyframes before first copy stay in place,
+        // self move would empty members like std::vector
+        size_t write = keyframes.size();
+        uint32_t next = validCount;
+        for (size_t read = oldSize; read-- > 0 && next > 0;)
+        {
+            if (indices[next - 1] == read)
+            {
+                keyframes[--write] = keyframes[read];
+                while (next > 0 && indices[next - 1] == read) next--;
+            }
+            if (--write != read) keyframes[write] = std::move(keyframes[read]);
+        }
+    }
+
+    // Shifts frame of indexed keyframes, frame is member of keyframe struct
+    template<typename T, typename Key>
+    void NeoShiftIndices(T* keyframes, size_t keyframeCount, const uint32_t* indices, uint32_t indexCount, FrameIndexType delta, FrameIndexType Key::* frame)
+    {
+        std::vector<uint32_t> scratch;
+        indices = NeoSortedIndices(indices, indexCount, scratch);
+
+        for (uint32_t i = 0; i < indexCount; i++)
+            if (indices[i] < keyframeCount && (i == 0 || indices[i] != indices[i - 1]))
+                keyframes[indices[i]].*frame += delta;
+    }
+
+    inline void NeoShiftIndices(FrameIndexType* keyframes, size_t keyframeCount, const uint32_t* indices, uint32_t indexCount, FrameIndexType delta)
+    {
+        std::vector<uint32_t> scratch;
+        indices = NeoSortedIndices(indices, indexCount, scratch);
+
+        for (uint32_t i = 0; i < indexCount; i++)
+            if (indices[i] < keyframeCount && (i == 0 || indices[i] != indices[i - 1]))
+                keyframes[indices[i]] += delta;
+    }
+
     // Sets currently selected timeline inside BeginNeoSequencer scope
     IMGUI_API void SetSelectedTimeline(const char* timelineLabel);
 
     IMGUI_API bool IsNeoTimelineSelected(ImGuiNeoTimelineIsSelectedFlags flags = ImGuiNeoTimelineIsSelectedFlags_None);
 
+    // Sets data generation of next timeline, bump it whenever keyframes of that timeline change.
+    // Keyframe geometry of timelines submitted with keyframe arrays is then cached and reused while generation, view and style stay the same.
+    IMGUI_API void SetNextNeoTimelineGeneration(uint32_t generation);
+
+    // Optional arrays parallel to keyframes of bulk timeline (keyframe array, strided, prepared), nullptr = style default.
+    // Arrays are read while timeline is drawn, they are part of timeline data for SetNextNeoTimelineGeneration().
+    struct NeoKeyframeAttributes {
+        const ImU32*    Colors  = nullptr;  // Color of idle keyframe, 0 = style color
+        const ImU8*     Shapes  = nullptr;  // ImGuiNeoKeyframeShape_
+        const ImU8*     Flags   = nullptr;  // ImGuiNeoKeyframeFlags_
+    };
+    IMGUI_API void SetNextNeoTimelineKeyframeAttributes(const NeoKeyframeAttributes& attributes);
+
 #ifdef __cplusplus
     // C++ helper
     IMGUI_API bool BeginNeoTimeline(const char* label,std::vector<int32_t> & keyframes ,bool * open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
+
+    // Keyframes stored in place, frame of i-th keyframe is at (char*)firstFrame + i * stride. Const frames are read only.
+    IMGUI_API bool BeginNeoTimelineStrided(const char* label, FrameIndexType* firstFrame, uint32_t keyframeCount, size_t stride, bool* open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
+    IMGUI_API bool BeginNeoTimelineStrided(const char* label, const FrameIndexType* firstFrame, uint32_t keyframeCount, size_t stride, bool* open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
+
+    // Timeline over contiguous range of user keyframe structs (std::vector, std::array, span...), e.g. BeginNeoTimeline("Pos", keys, &Key::frame).
+    // Const range is read only, its keyframes can be selected but stay in place when selection is dragged. No copy of keyframes is made.
+    template<typename Range, typename Key>
+    bool BeginNeoTimeline(const char* label, Range& range, FrameIndexType Key::* frame, bool* open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None)
+    {
+        auto* keys = range.data();
+        const uint32_t count = (uint32_t) range.size();
+        return BeginNeoTimelineStrided(label, count ? &(keys->*frame) : nullptr, count, sizeof(*keys), open, flags);
+    }
 #endif
 
     // Retrieves the currently viewed frame range
     struct NeoFrameRange { FrameIndexType from; FrameIndexType to; };
     IMGUI_API NeoFrameRange NeoGetViewRange();
+    // View range expected secondsAhead from now, extrapolated from recent pan and zoom velocity (slider drag, mouse wheel).
+    // Settles to current view range once view stops moving, use it to prefetch data before it's scrolled into view.
+    IMGUI_API NeoFrameRange NeoGetPredictedViewRange(float secondsAhead = 0.25f);
+
+    // Batched NeoActiveZone(), zones outside of view are culled and zones narrower than a pixel are merged. Call inside timeline scope.
+    // Stacked zones are hashed every frame to detect changes, use SetNextNeoTimelineGeneration() on the timeline to skip it.
+    IMGUI_API void NeoActiveZones(const char* id, NeoFrameRange* zones, uint32_t zoneCount, ImGuiNeoActiveZonesFlags flags = ImGuiNeoActiveZonesFlags_None);
+    // Finds zones of NeoActiveZones(id, ..., ImGuiNeoActiveZonesFlags_Stack) overlapping [from, to], in O(log n + k). Call inside same timeline scope.
+    // Writes up to indicesCount zone indices (and their sub-rows if rows is set), returns total amount of overlapping zones.
+    IMGUI_API uint32_t NeoQueryActiveZones(const char* id, FrameIndexType from, FrameIndexType to, uint32_t* indices, uint32_t indicesCount, uint32_t* rows = nullptr);
 
     // Like PlotLines() but as a timeline ! Use with NeoGetViewRange() to prepare the data.
     IMGUI_API void NeoTimelinePlot(const char* id, const float* data, int values_count, float scale_min = 0, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 30), ...);
 
+    // Key of curve lane, segment between two keys is cubic Hermite using OutTangent of first and InTangent of second key (value change per frame)
+    struct NeoCurveKey { FrameIndexType Frame; float Value; float InTangent; float OutTangent; };
+
+    // Editable curve lane, keys have to be sorted by frame. Tessellation is cached per curve and adapts to curvature and pixel width, returns true if key was edited.
+    // Use SetNextNeoTimelineGeneration() before it to skip change detection of keys.
+    IMGUI_API bool NeoTimelineCurve(const char* id, NeoCurveKey* keys, int keyCount, float scale_min, float scale_max, ImVec2 graph_size = ImVec2(0, 60));
+
+    // Two phase timelines for big scenes, NeoPrepareTimelines() culls keyframes and computes their positions / density in parallel,
+    // BeginNeoTimeline(label, prepared) then only emits visible keyframes. Keyframes of every timeline have to be sorted.
+    struct NeoViewParams { FrameIndexType ViewFrom; FrameIndexType ViewTo; FrameIndexType OriginFrame; float PerFrameWidth; float Width; };
+    struct NeoPreparedTimeline {
+        FrameIndexType*         Keyframes       = nullptr;      // Input
+        uint32_t                KeyframeCount   = 0;
+        uint32_t                VisibleFrom     = 0;            // Output, range of visible keyframes
+        uint32_t                VisibleTo       = 0;
+        std::vector<float>      PositionsX;                     // Output, per visible keyframe position from start of timeline
+        std::vector<uint32_t>   Density;                        // Output, keyframes per pixel, used instead of positions when there are more keyframes than pixels
+    };
+    IMGUI_API NeoViewParams NeoGetViewParams(); // Snapshot of view, call inside sequencer scope
+    IMGUI_API void NeoPrepareTimelines(const NeoViewParams& view, NeoPreparedTimeline* timelines, uint32_t timelineCount, uint32_t threadCount = 0); // Thread-safe, concurrent calls share worker threads and run one after another, threadCount 0 = all hardware threads
+    IMGUI_API bool BeginNeoTimeline(const char* label, NeoPreparedTimeline& timeline, bool* open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
+
+    // Lazily loaded timelines, keyframes are fetched asynchronously per window of frames and kept in cache limited by memory budget (LRU).
+    // Fetch is called on worker thread with [from, to) range and has to append at most to - from keyframes, returning false marks window
+    // as failed, it's fetched again after a while if still visible.
+    // Missing windows are drawn as placeholder until fetched, UI thread never waits for fetch. Provided keyframes are read only.
+    typedef bool (*NeoLaneFetchFunc)(void* userData, ImGuiID laneID, FrameIndexType from, FrameIndexType to, std::vector<FrameIndexType>& keyframes);
+    IMGUI_API ImGuiNeoLaneProvider* NeoCreateLaneProvider(NeoLaneFetchFunc fetch, void* userData, size_t memoryBudget, FrameIndexType windowSize = 1024);
+    IMGUI_API void NeoDestroyLaneProvider(ImGuiNeoLaneProvider* provider);
+    IMGUI_API void NeoInvalidateLaneProvider(ImGuiNeoLaneProvider* provider, ImGuiID laneID); // Drops cached windows of lane, they are fetched again
+    IMGUI_API bool BeginNeoTimelineProvided(const char* label, ImGuiNeoLaneProvider* provider, ImGuiID laneID, bool* open = nullptr, ImGuiNeoTimelineFlags flags = ImGuiNeoTimelineFlags_None);
+
     // Begin/End a tooltip @ time cursor on the previously closed timeline lane. Works good with plotlanes.
     IMGUI_API bool NeoBeginTimeCursorTooltip(const char* id, NeoTooltipPositionFlags _flags = NeoTooltipPositionFlags_TimeCursor, float width=ImGui::GetFrameHeight()*2);
     IMGUI_API void NeoEndTimeCursorTooltip();
 
+    // Playback, call NeoPlaybackUpdate() every frame before BeginNeoSequencer() with same frame pointer.
+    // Frame set from outside (scrubbing) re-anchors playback there. Returns true if frame changed.
+    IMGUI_API bool NeoPlaybackUpdate(ImGuiNeoPlayback* playback, FrameIndexType* frame, FrameIndexType startFrame, FrameIndexType endFrame);
+    IMGUI_API void NeoPlaybackPlay(ImGuiNeoPlayback* playback);
+    IMGUI_API void NeoPlaybackPause(ImGuiNeoPlayback* playback);
+    IMGUI_API void NeoPlaybackSeek(ImGuiNeoPlayback* playback, double frame);
+    IMGUI_API void NeoPlaybackStep(ImGuiNeoPlayback* playback, int32_t frames); // Moves exactly by given amount of frames
+
     // Draw some rects on the timeline
     IMGUI_API void NeoDrawTimelineRect(FrameIndexType from, FrameIndexType to, ImVec4 color={1,1,1,0.1}, const bool inPrevLane=false);
 }
@@ -0,0 +1,141 @@
+//
+// Counts heap allocations of reference scenes once caches are warm, steady frames must not allocate
+//
+
+#include "neo_test_support.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+static std::atomic<uint32_t> allocationCount(0);
+static std::atomic<bool> countAllocations(false);
+
+static void* countedAlloc(std::size_t size, std::size_t alignment = 0)
+{
+    if (countAllocations)
+        allocationCount++;
+    if (size == 0)
+        size = 1;
+    if (alignment > alignof(std::max_align_t))
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    return std::malloc(size);
+}
+
+static void* countedAllocOrThrow(std::size_t size, std::size_t alignment = 0)
+{
+    if (void* ptr = countedAlloc(size, alignment))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size) { return countedAllocOrThrow(size); }
+void* operator new[](std::size_t size) { return countedAllocOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new(std::size_t size, std::align_val_t align) { return countedAllocOrThrow(size, (std::size_t) align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return countedAllocOrThrow(size, (std::size_t) align); }
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return countedAlloc(size, (std::size_t) align); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return countedAlloc(size, (std::size_t) align); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+static void* countingImGuiAlloc(size_t size, void*)
+{
+    return countedAlloc(size);
+}
+
+static void countingImGuiFree(void* ptr, void*)
+{
+    std::free(ptr);
+}
+
+// Frames rendered before counting, caches and ImGui buffers reach their size
+static const int warmupFrames = 8;
+
+// Frames in which no allocation is allowed
+static const int steadyFrames = 8;
+
+static bool countSteadyFrames(NeoTestContext& context, const char* name, void (*draw)(), int frames)
+{
+    allocationCount = 0;
+    countAllocations = true;
+    for (int i = 0; i < frames; i++)
+        context.Frame(draw);
+    countAllocations = false;
+
+    const uint32_t count = allocationCount;
+    printf("%-4s %-16s %u allocations in %d frames\n", count == 0 ? "OK" : "FAIL", name, count, frames);
+    return count == 0;
+}
+
+static bool checkScene(NeoTestContext& context, const NeoTestScene& scene)
+{
+    for (int i = 0; i < warmupFrames; i++)
+        context.Frame(scene.Draw);
+
+    return countSteadyFrames(context, scene.Name, scene.Draw, steadyFrames);
+}
+
+// Interaction is warmed up by whole cycles, provided windows are fetched in meantime
+static bool checkInteraction(NeoTestContext& context)
+{
+    using namespace NeoTestData;
+
+    NeoTestSetupInteraction();
+    for (int cycle = 0; cycle < 4; cycle++)
+    {
+        for (int i = 0; i < interactionCycleFrames; i++)
+            context.Frame(NeoTestSceneInteraction);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    // Probing for keyframe may take extra frames, count from start of next cycle
+    while (interaction.Frame != 0)
+        context.Frame(NeoTestSceneInteraction);
+
+    bool ok = true;
+    if (!interaction.HasGrab)
+    {
+        printf("FAIL interaction: no selected keyframe found to drag\n");
+        ok = false;
+    }
+
+    ok = countSteadyFrames(context, "interaction", NeoTestSceneInteraction, interactionCycleFrames * 2) && ok;
+    NeoTestTeardownInteraction();
+    return ok;
+}
+
+int main()
+{
+    // Set before context is created so all ImGui memory goes through counter
+    ImGui::SetAllocatorFunctions(countingImGuiAlloc, countingImGuiFree, nullptr);
+
+    NeoTestContext context;
+    NeoTestSetupScenes();
+
+    int failed = 0;
+    for (const auto& scene: neoTestScenes)
+    {
+        if (!checkScene(context, scene))
+            failed++;
+    }
+
+    if (!checkInteraction(context))
+        failed++;
+
+    return failed == 0 ? 0 : 1;
+}
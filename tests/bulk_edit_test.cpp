@@ -0,0 +1,129 @@
+//
+// Bulk keyframe edits by indices against straightforward reference
+//
+
+#include "neo_test_support.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+
+// Member owning memory, moved from keyframes would lose it
+struct NeoTestKeyframe
+{
+    std::vector<int> Payload;
+    int32_t Frame;
+
+    bool operator==(const NeoTestKeyframe& other) const
+    {
+        return Frame == other.Frame && Payload == other.Payload;
+    }
+};
+
+static std::vector<NeoTestKeyframe> makeKeyframes(std::mt19937& rng, int count)
+{
+    std::vector<NeoTestKeyframe> keyframes;
+    for (int i = 0; i < count; i++)
+        keyframes.push_back({std::vector<int>((size_t) (rng() % 4) + 1, i), i * 10});
+    return keyframes;
+}
+
+// Unsorted, with duplicates and out of range indices
+static std::vector<uint32_t> makeIndices(std::mt19937& rng, int keyframeCount)
+{
+    std::vector<uint32_t> indices((size_t) (rng() % 12));
+    for (auto& index: indices)
+        index = (uint32_t) (rng() % (uint32_t) (keyframeCount + 3));
+    if (rng() % 2 == 0)
+        std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+static std::set<uint32_t> toSet(const std::vector<uint32_t>& indices)
+{
+    return std::set<uint32_t>(indices.begin(), indices.end());
+}
+
+static void testErase(std::mt19937& rng)
+{
+    int mismatches = 0;
+    for (int round = 0; round < 500; round++)
+    {
+        auto keyframes = makeKeyframes(rng, (int) (rng() % 20));
+        const auto indices = makeIndices(rng, (int) keyframes.size());
+        const auto erased = toSet(indices);
+
+        std::vector<NeoTestKeyframe> expected;
+        for (uint32_t i = 0; i < (uint32_t) keyframes.size(); i++)
+            if (!erased.count(i))
+                expected.push_back(keyframes[i]);
+
+        ImGui::NeoEraseIndices(keyframes, indices.data(), (uint32_t) indices.size());
+        if (!(keyframes == expected))
+            mismatches++;
+    }
+    NEO_CHECK(mismatches == 0);
+}
+
+static void testDuplicate(std::mt19937& rng)
+{
+    int mismatches = 0;
+    for (int round = 0; round < 500; round++)
+    {
+        auto keyframes = makeKeyframes(rng, (int) (rng() % 20));
+        const auto indices = makeIndices(rng, (int) keyframes.size());
+        const auto duplicated = toSet(indices);
+
+        std::vector<NeoTestKeyframe> expected;
+        for (uint32_t i = 0; i < (uint32_t) keyframes.size(); i++)
+        {
+            expected.push_back(keyframes[i]);
+            if (duplicated.count(i))
+                expected.push_back(keyframes[i]);
+        }
+
+        ImGui::NeoDuplicateIndices(keyframes, indices.data(), (uint32_t) indices.size());
+        if (!(keyframes == expected))
+            mismatches++;
+    }
+    NEO_CHECK(mismatches == 0);
+}
+
+static void testShift(std::mt19937& rng)
+{
+    int mismatches = 0;
+    for (int round = 0; round < 500; round++)
+    {
+        auto keyframes = makeKeyframes(rng, (int) (rng() % 20));
+        const auto indices = makeIndices(rng, (int) keyframes.size());
+        const auto shifted = toSet(indices);
+
+        auto expected = keyframes;
+        std::vector<int32_t> frames, expectedFrames;
+        for (uint32_t i = 0; i < (uint32_t) keyframes.size(); i++)
+        {
+            if (shifted.count(i))
+                expected[i].Frame += 5;
+            frames.push_back(keyframes[i].Frame);
+            expectedFrames.push_back(expected[i].Frame);
+        }
+
+        ImGui::NeoShiftIndices(keyframes.data(), keyframes.size(), indices.data(), (uint32_t) indices.size(), 5,
+                               &NeoTestKeyframe::Frame);
+        ImGui::NeoShiftIndices(frames.data(), frames.size(), indices.data(), (uint32_t) indices.size(), 5);
+        if (!(keyframes == expected) || frames != expectedFrames)
+            mismatches++;
+    }
+    NEO_CHECK(mismatches == 0);
+}
+
+int main()
+{
+    std::mt19937 rng(13);
+    testErase(rng);
+    testDuplicate(rng);
+    testShift(rng);
+
+    printf("%s bulk_edit_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}
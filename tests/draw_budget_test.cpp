@@ -0,0 +1,105 @@
+//
+// Draws reference scenes headless and checks draw stats against checked-in budgets
+// "draw_budget_test --record" prints measured stats in draw_budgets.h format instead
+//
+
+#include "neo_test_support.h"
+#include "draw_budgets.h"
+
+#include <cstring>
+
+// Frames rendered per scene, last two must be identical
+static const int sceneFrames = 4;
+
+static const NeoDrawBudget* findBudget(const char* scene)
+{
+    for (const auto& budget: neoDrawBudgets)
+    {
+        if (strcmp(budget.Scene, scene) == 0)
+            return &budget;
+    }
+    return nullptr;
+}
+
+static ImGui::NeoDrawStats drawScene(NeoTestContext& context, const NeoTestScene& scene, bool* stable)
+{
+    ImGui::NeoDrawStats stats[sceneFrames] = {};
+    for (auto& frameStats: stats)
+    {
+        context.Frame(scene.Draw);
+        frameStats = ImGui::GetNeoSequencerDrawStats();
+    }
+
+    *stable = stats[sceneFrames - 1].Checksum == stats[sceneFrames - 2].Checksum;
+    return stats[sceneFrames - 1];
+}
+
+static bool checkScene(NeoTestContext& context, const NeoTestScene& scene)
+{
+    const NeoDrawBudget* budget = findBudget(scene.Name);
+    if (!budget)
+    {
+        printf("FAIL %s: no budget in draw_budgets.h\n", scene.Name);
+        return false;
+    }
+
+    bool stable = false;
+    const ImGui::NeoDrawStats last = drawScene(context, scene, &stable);
+    bool ok = true;
+
+    if (!stable)
+    {
+        printf("FAIL %s: output not stable between idle frames\n", scene.Name);
+        ok = false;
+    }
+    if (last.VtxCount == 0)
+    {
+        printf("FAIL %s: nothing drawn\n", scene.Name);
+        ok = false;
+    }
+    if (last.VtxCount > budget->MaxVtx || last.IdxCount > budget->MaxIdx || last.CmdCount > budget->MaxCmd)
+    {
+        printf("FAIL %s: over budget\n", scene.Name);
+        ok = false;
+    }
+    if (last.DegradedLanes != budget->DegradedLanes)
+    {
+        printf("FAIL %s: %u degraded lanes, expected %u\n", scene.Name, last.DegradedLanes, budget->DegradedLanes);
+        ok = false;
+    }
+
+    printf("%-4s %-16s vtx %6u/%-6u idx %6u/%-6u cmd %3u/%-3u degraded %u\n", ok ? "OK" : "FAIL", scene.Name,
+           last.VtxCount, budget->MaxVtx, last.IdxCount, budget->MaxIdx, last.CmdCount, budget->MaxCmd,
+           last.DegradedLanes);
+    return ok;
+}
+
+static void recordScene(NeoTestContext& context, const NeoTestScene& scene)
+{
+    bool stable = false;
+    const ImGui::NeoDrawStats last = drawScene(context, scene, &stable);
+
+    char name[32];
+    snprintf(name, sizeof(name), "\"%s\",", scene.Name);
+    printf("        {%-18s%-8u%-8u%-8u%u},%s\n", name, last.VtxCount, last.IdxCount, last.CmdCount, last.DegradedLanes,
+           stable ? "" : " // not stable between idle frames");
+}
+
+int main(int argc, char** argv)
+{
+    const bool record = argc > 1 && strcmp(argv[1], "--record") == 0;
+
+    NeoTestContext context;
+    NeoTestSetupScenes();
+
+    int failed = 0;
+    for (const auto& scene: neoTestScenes)
+    {
+        if (record)
+            recordScene(context, scene);
+        else if (!checkScene(context, scene))
+            failed++;
+    }
+
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,30 @@
+//
+// Checked-in draw budgets of reference scenes from neo_test_support.h
+// Regenerate with "draw_budget_test --record" together with the change that makes a scene heavier
+//
+
+#ifndef IMGUI_NEO_DRAW_BUDGETS_H
+#define IMGUI_NEO_DRAW_BUDGETS_H
+
+#include <cstdint>
+
+struct NeoDrawBudget
+{
+    const char* Scene;
+    uint32_t    MaxVtx;
+    uint32_t    MaxIdx;
+    uint32_t    MaxCmd;
+    uint32_t    DegradedLanes; // Exact count of lanes expected to be simplified to fit VertexBudget
+};
+
+static const NeoDrawBudget neoDrawBudgets[] = {
+        // Scene            MaxVtx  MaxIdx  MaxCmd  DegradedLanes
+        {"empty",           4000,   10000,  32,     0},
+        {"keyframes",       16000,  54000,  32,     0},
+        {"vertex_budget",   20000,  36000,  32,     4},
+        {"offscreen_keys",  6000,   14000,  32,     0},
+        {"curve",           10000,  36000,  32,     0},
+        {"zones",           10000,  20000,  32,     0},
+};
+
+#endif //IMGUI_NEO_DRAW_BUDGETS_H
@@ -0,0 +1,146 @@
+//
+// Batched evaluator against scalar reference, cursor reuse across seeks and long sequences
+//
+
+#include "neo_test_support.h"
+#include "imgui_neo_evaluator.h"
+
+#include <cstring>
+#include <random>
+
+struct NeoTestChannel
+{
+    std::vector<int32_t> Frames;
+    std::vector<float> Values;
+    std::vector<ImU8> Interpolations;
+};
+
+// Straightforward evaluation of single channel
+static float evaluateScalar(const NeoTestChannel& channel, double frame)
+{
+    const int count = (int) channel.Frames.size();
+    if (count == 0)
+        return 0.0f;
+
+    int key = 0;
+    for (int i = 1; i < count; i++)
+    {
+        if ((double) channel.Frames[i] <= frame)
+            key = i;
+    }
+
+    if (key + 1 == count || (double) channel.Frames[key] >= frame ||
+        channel.Interpolations[key] == ImGuiNeoInterpolation_Constant)
+        return channel.Values[key];
+
+    const double t = (frame - channel.Frames[key]) / ((double) channel.Frames[key + 1] - channel.Frames[key]);
+    double weight = t;
+    if (channel.Interpolations[key] == ImGuiNeoInterpolation_Smooth)
+        weight = t * t * (3.0 - 2.0 * t);
+    return (float) (channel.Values[key] + (channel.Values[key + 1] - channel.Values[key]) * weight);
+}
+
+static bool nearlyEqual(float a, float b)
+{
+    return std::fabs(a - b) <= 1e-4f * std::fmax(1.0f, std::fabs(b));
+}
+
+static std::vector<NeoTestChannel> makeChannels(std::mt19937& rng, int channelCount)
+{
+    std::vector<NeoTestChannel> channels(channelCount);
+    for (auto& channel: channels)
+    {
+        const int keyCount = (int) (rng() % 24); // Some channels are empty or have single key
+        int32_t frame = (int32_t) (rng() % 50) - 25;
+        for (int i = 0; i < keyCount; i++)
+        {
+            frame += (int32_t) (rng() % 20); // Duplicate frames happen too
+            channel.Frames.push_back(frame);
+            channel.Values.push_back((float) (rng() % 2000) / 100.0f - 10.0f);
+            channel.Interpolations.push_back((ImU8) (rng() % 3));
+        }
+    }
+    return channels;
+}
+
+static void addChannels(ImGuiNeoEvaluator& evaluator, const std::vector<NeoTestChannel>& channels)
+{
+    for (const auto& channel: channels)
+        evaluator.AddChannel(channel.Frames.data(), channel.Values.data(), channel.Interpolations.data(),
+                             (uint32_t) channel.Frames.size());
+}
+
+static int checkFrame(ImGuiNeoEvaluator& evaluator, const std::vector<NeoTestChannel>& channels, double frame)
+{
+    const float* results = evaluator.Evaluate(frame);
+    int mismatches = 0;
+    for (size_t c = 0; c < channels.size(); c++)
+    {
+        if (!nearlyEqual(results[c], evaluateScalar(channels[c], frame)))
+            mismatches++;
+    }
+    return mismatches;
+}
+
+// Playback forwards and backwards, then random seeks, all compared with scalar reference
+static void testAgainstScalar()
+{
+    std::mt19937 rng(7);
+    const auto channels = makeChannels(rng, 500);
+    ImGuiNeoEvaluator evaluator;
+    addChannels(evaluator, channels);
+    NEO_CHECK(evaluator.GetChannelCount() == 500);
+
+    int mismatches = 0;
+    for (double frame = -40.0; frame < 500.0; frame += 0.25)
+        mismatches += checkFrame(evaluator, channels, frame);
+    for (double frame = 500.0; frame > -40.0; frame -= 0.75)
+        mismatches += checkFrame(evaluator, channels, frame);
+    for (int i = 0; i < 2000; i++)
+        mismatches += checkFrame(evaluator, channels, (double) (rng() % 600000) / 1000.0 - 50.0);
+    NEO_CHECK(mismatches == 0);
+}
+
+// Results don't depend on where cursors were left by previous evaluations
+static void testCursorReuse()
+{
+    std::mt19937 rng(11);
+    const auto channels = makeChannels(rng, 200);
+    ImGuiNeoEvaluator warm;
+    addChannels(warm, channels);
+
+    const double frames[] = {10.5, 400.0, -30.0, 10.5, 123.25, 124.0, 122.5, 300.75, 10.5};
+    for (const double frame: frames)
+    {
+        ImGuiNeoEvaluator fresh;
+        addChannels(fresh, channels);
+
+        const float* warmResults = warm.Evaluate(frame);
+        const float* freshResults = fresh.Evaluate(frame);
+        NEO_CHECK(memcmp(warmResults, freshResults, channels.size() * sizeof(float)) == 0);
+    }
+}
+
+// Fractional frames stay exact far beyond 2^24
+static void testLongSequence()
+{
+    const int32_t frames[] = {50000000, 50000001, 50000003};
+    const float values[] = {0.0f, 1.0f, 5.0f};
+    ImGuiNeoEvaluator evaluator;
+    evaluator.AddChannel(frames, values, nullptr, 3);
+
+    NEO_CHECK(nearlyEqual(evaluator.Evaluate(50000000.5)[0], 0.5f));
+    NEO_CHECK(nearlyEqual(evaluator.Evaluate(50000001.0)[0], 1.0f));
+    NEO_CHECK(nearlyEqual(evaluator.Evaluate(50000002.0)[0], 3.0f));
+    NEO_CHECK(nearlyEqual(evaluator.Evaluate(49999999.0)[0], 0.0f));
+}
+
+int main()
+{
+    testAgainstScalar();
+    testCursorReuse();
+    testLongSequence();
+
+    printf("%s evaluator_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+//
+// Events of several sequencers in one frame and overflow of event buffer
+//
+
+#include "neo_test_support.h"
+
+static ImGui::FrameIndexType frameA = 0, frameB = 0;
+static ImGui::FrameIndexType startFrame = 0, endFrame = 100;
+static ImGuiID sequencerA = 0, sequencerB = 0;
+static bool clearSelectionA = false;
+
+static void drawScene()
+{
+    if (ImGui::BeginNeoSequencer("A", &frameA, &startFrame, &endFrame, ImVec2(600.0f, 150.0f)))
+    {
+        if (clearSelectionA)
+            ImGui::NeoClearSelection();
+        ImGui::EndNeoSequencer();
+        sequencerA = ImGui::GetNeoSequencerID();
+    }
+    if (ImGui::BeginNeoSequencer("B", &frameB, &startFrame, &endFrame, ImVec2(600.0f, 150.0f)))
+    {
+        ImGui::EndNeoSequencer();
+        sequencerB = ImGui::GetNeoSequencerID();
+    }
+}
+
+static int drainEvents(ImGuiID sequencer, ImGui::NeoEvent* last)
+{
+    int count = 0;
+    ImGui::NeoEvent event;
+    while (ImGui::NeoPollEvent(sequencer, &event))
+    {
+        *last = event;
+        count++;
+    }
+    return count;
+}
+
+// Each sequencer keeps its own events, they can be drained after both ended
+static void testPerSequencer(NeoTestContext& context)
+{
+    context.Frame(drawScene);
+    context.Frame(drawScene);
+    NEO_CHECK(sequencerA != 0 && sequencerB != 0 && sequencerA != sequencerB);
+
+    frameA = 10;
+    frameB = 20;
+    context.Frame(drawScene);
+
+    ImGui::NeoEvent event = {};
+    NEO_CHECK(drainEvents(sequencerA, &event) == 1);
+    NEO_CHECK(event.Type == ImGuiNeoEventType_CurrentFrameChanged && event.Frame == 10 && event.Delta == 10);
+    NEO_CHECK(ImGui::NeoPollEvent(sequencerA, &event) == false);
+
+    // Overload without id serves last ended sequencer
+    NEO_CHECK(ImGui::NeoPollEvent(&event));
+    NEO_CHECK(event.Type == ImGuiNeoEventType_CurrentFrameChanged && event.Frame == 20 && event.Delta == 20);
+    NEO_CHECK(drainEvents(sequencerB, &event) == 0);
+
+    NEO_CHECK(ImGui::GetNeoDroppedEventCount(sequencerA) == 0);
+    NEO_CHECK(ImGui::GetNeoDroppedEventCount(sequencerB) == 0);
+
+    // Undrained events are cleared on next frame
+    frameA = 11;
+    context.Frame(drawScene);
+    context.Frame(drawScene);
+    NEO_CHECK(drainEvents(sequencerA, &event) == 0);
+}
+
+// Full buffer drops oldest events and counts them
+static void testOverflow(NeoTestContext& context)
+{
+    auto& style = ImGui::GetNeoSequencerStyle();
+    const int capacity = style.EventCapacity;
+    style.EventCapacity = 1;
+
+    frameA = 30;
+    clearSelectionA = true;
+    context.Frame(drawScene);
+
+    ImGui::NeoEvent event = {};
+    NEO_CHECK(drainEvents(sequencerA, &event) == 1);
+    NEO_CHECK(event.Type == ImGuiNeoEventType_SelectionChanged);
+    NEO_CHECK(ImGui::GetNeoDroppedEventCount(sequencerA) == 1);
+    NEO_CHECK(ImGui::GetNeoDroppedEventCount(sequencerB) == 0);
+
+    clearSelectionA = false;
+    style.EventCapacity = capacity;
+    context.Frame(drawScene);
+    NEO_CHECK(ImGui::GetNeoDroppedEventCount(sequencerA) == 0);
+}
+
+int main()
+{
+    NeoTestContext context;
+    testPerSequencer(context);
+    testOverflow(context);
+
+    printf("%s events_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}
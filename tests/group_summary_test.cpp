@@ -0,0 +1,144 @@
+//
+// Incremental group summary against brute force union of its tracks
+//
+
+#include "neo_test_support.h"
+#include "imgui_neo_sequencer.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+typedef std::map<ImGuiID, std::vector<int32_t>> NeoTestTracks;
+
+static std::vector<int32_t> makeTrack(std::mt19937& rng)
+{
+    std::vector<int32_t> keys((size_t) (rng() % 40)); // Some tracks are empty
+    for (auto& key: keys)
+        key = (int32_t) (rng() % 200) - 50; // Duplicates within track happen too
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// Frame -> amount of tracks having keyframe on it
+static bool matchesUnion(const ImGuiNeoGroupSummary& summary, const NeoTestTracks& tracks)
+{
+    std::map<int32_t, uint32_t> expected;
+    for (const auto& track: tracks)
+    {
+        std::vector<int32_t> unique = track.second;
+        unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+        for (const int32_t frame: unique)
+            expected[frame]++;
+    }
+
+    if (summary.Frames.Size != (int) expected.size() || summary.Counts.Size != summary.Frames.Size)
+        return false;
+
+    int i = 0;
+    for (const auto& entry: expected)
+    {
+        if (summary.Frames[i] != entry.first || summary.Counts[i] != entry.second)
+            return false;
+        i++;
+    }
+    return true;
+}
+
+static void build(ImGuiNeoGroupSummary& summary, const NeoTestTracks& tracks)
+{
+    std::vector<ImGuiID> ids;
+    std::vector<const int32_t*> keys;
+    std::vector<uint32_t> counts;
+    for (const auto& track: tracks)
+    {
+        ids.push_back(track.first);
+        keys.push_back(track.second.data());
+        counts.push_back((uint32_t) track.second.size());
+    }
+    summary.Build(ids.data(), keys.data(), counts.data(), (uint32_t) ids.size());
+}
+
+static void testBuild()
+{
+    std::mt19937 rng(3);
+    for (int round = 0; round < 50; round++)
+    {
+        NeoTestTracks tracks;
+        const int trackCount = (int) (rng() % 12);
+        for (int t = 0; t < trackCount; t++)
+            tracks[(ImGuiID) (rng() % 1000) + 1] = makeTrack(rng);
+
+        ImGuiNeoGroupSummary summary;
+        build(summary, tracks);
+        NEO_CHECK(matchesUnion(summary, tracks));
+    }
+}
+
+// Random edits of built summary, union is compared after every one
+static void testIncremental()
+{
+    std::mt19937 rng(5);
+    NeoTestTracks tracks;
+    for (int t = 0; t < 6; t++)
+        tracks[(ImGuiID) t + 1] = makeTrack(rng);
+
+    ImGuiNeoGroupSummary summary;
+    build(summary, tracks);
+    NEO_CHECK(matchesUnion(summary, tracks));
+
+    int mismatches = 0;
+    for (int step = 0; step < 3000; step++)
+    {
+        const auto trackID = (ImGuiID) (rng() % 16) + 1; // Existing as well as new and already removed tracks
+        switch (rng() % 4)
+        {
+            case 0:
+                summary.RemoveTrack(trackID);
+                tracks.erase(trackID);
+                break;
+            case 1:
+            {
+                // Single key moved, the common case while dragging
+                auto& keys = tracks[trackID];
+                if (!keys.empty())
+                    keys[rng() % keys.size()] += (int32_t) (rng() % 7) - 3;
+                std::sort(keys.begin(), keys.end());
+                summary.SetTrack(trackID, keys.data(), (uint32_t) keys.size());
+                break;
+            }
+            default:
+            {
+                auto& keys = tracks[trackID];
+                keys = makeTrack(rng);
+                summary.SetTrack(trackID, keys.data(), (uint32_t) keys.size());
+                break;
+            }
+        }
+        if (!matchesUnion(summary, tracks))
+            mismatches++;
+    }
+    NEO_CHECK(mismatches == 0);
+
+    // Track slots survive removal of other tracks
+    NEO_CHECK(summary.TrackIDs.size() == tracks.size());
+    for (size_t slot = 0; slot < summary.TrackIDs.size(); slot++)
+        NEO_CHECK(tracks[summary.TrackIDs[slot]] == summary.TrackKeys[slot]);
+
+    summary.Clear();
+    NEO_CHECK(summary.Frames.empty() && summary.TrackIDs.empty());
+    tracks.clear();
+    const int32_t keys[] = {1, 1, 4};
+    summary.SetTrack(7, keys, 3);
+    tracks[7] = {1, 1, 4};
+    NEO_CHECK(matchesUnion(summary, tracks));
+}
+
+int main()
+{
+    testBuild();
+    testIncremental();
+
+    printf("%s group_summary_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}
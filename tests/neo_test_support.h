@@ -0,0 +1,358 @@
+//
+// Headless ImGui context and reference scenes shared by tests
+//
+
+#ifndef IMGUI_NEO_TEST_SUPPORT_H
+#define IMGUI_NEO_TEST_SUPPORT_H
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_neo_sequencer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Failed checks of test executable, main() returns non zero when any failed
+static int neoTestFailures = 0;
+
+#define NEO_CHECK(expr) do { if (!(expr)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #expr); neoTestFailures++; } } while (0)
+
+// ImGui context rendering frames without backend, every frame has same size, delta time and font
+struct NeoTestContext
+{
+    NeoTestContext()
+    {
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.LogFilename = nullptr;
+        io.DisplaySize = ImVec2(1280.0f, 720.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+
+        // Builds atlas with default font, no texture is uploaded
+        unsigned char* pixels = nullptr;
+        int width = 0, height = 0;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    }
+
+    ~NeoTestContext()
+    {
+        ImGui::DestroyContext();
+    }
+
+    template<typename Body>
+    void Frame(Body&& body)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+        ImGui::Begin("Test", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+        body();
+        ImGui::End();
+        ImGui::Render();
+    }
+};
+
+struct NeoTestScene
+{
+    const char* Name;
+    void (*Draw)();
+};
+
+// Data of reference scenes, built once by NeoTestSetupScenes() so frames don't allocate
+namespace NeoTestData
+{
+    static const ImVec2 sequencerSize = {800.0f, 300.0f};
+
+    static ImGui::FrameIndexType currentFrame = 0;
+    static ImGui::FrameIndexType startFrame = 0;
+    static ImGui::FrameIndexType endFrame = 1000;
+
+    static ImGui::FrameIndexType longEndFrame = 20000;
+
+    static const char* trackLabels[] = {"Track 0", "Track 1", "Track 2", "Track 3", "Track 4",
+                                        "Track 5", "Track 6", "Track 7", "Track 8", "Track 9"};
+
+    static std::vector<int32_t> tracks[10]; // 100 keyframes each
+    static std::vector<int32_t> longTracks[4]; // 20000 sorted keyframes each
+    static std::vector<int32_t> offscreenTrack; // 100 keyframes in view, then 20000 past end of sequence, unsorted
+    static std::vector<ImGui::NeoCurveKey> curve; // 300 keys
+    static std::vector<ImGui::NeoFrameRange> zones; // 200 overlapping zones
+}
+
+inline void NeoTestSetupScenes()
+{
+    using namespace NeoTestData;
+
+    for (auto& track: tracks)
+    {
+        track.clear();
+        for (int32_t i = 0; i < 100; i++)
+            track.push_back(i * 10);
+    }
+
+    for (auto& track: longTracks)
+    {
+        track.clear();
+        for (int32_t i = 0; i < 20000; i++)
+            track.push_back(i);
+    }
+
+    offscreenTrack.clear();
+    for (int32_t i = 0; i < 100; i++)
+        offscreenTrack.push_back(i * 10);
+    for (int32_t i = 0; i < 20000; i++)
+        offscreenTrack.push_back(endFrame + 100 + (i * 7919) % 20000);
+
+    curve.clear();
+    for (int32_t i = 0; i < 300; i++)
+        curve.push_back({i * 3, std::sin((float) i * 0.1f), 0.0f, 0.0f});
+
+    zones.clear();
+    for (int32_t i = 0; i < 200; i++)
+        zones.push_back({i * 4, i * 4 + 20});
+}
+
+inline void NeoTestSceneEmpty()
+{
+    using namespace NeoTestData;
+    if (ImGui::BeginNeoSequencer("Empty", &currentFrame, &startFrame, &endFrame, sequencerSize))
+        ImGui::EndNeoSequencer();
+}
+
+inline void NeoTestSceneKeyframes()
+{
+    using namespace NeoTestData;
+    if (ImGui::BeginNeoSequencer("Keyframes", &currentFrame, &startFrame, &endFrame, sequencerSize))
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            if (ImGui::BeginNeoTimeline(trackLabels[i], tracks[i]))
+                ImGui::EndNeoTimeLine();
+        }
+        ImGui::EndNeoSequencer();
+    }
+}
+
+inline void NeoTestSceneVertexBudget()
+{
+    using namespace NeoTestData;
+    auto& style = ImGui::GetNeoSequencerStyle();
+    const uint32_t budget = style.VertexBudget;
+    style.VertexBudget = 40000;
+
+    if (ImGui::BeginNeoSequencer("VertexBudget", &currentFrame, &startFrame, &longEndFrame, sequencerSize))
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            if (ImGui::BeginNeoTimeline(trackLabels[i], longTracks[i], nullptr, ImGuiNeoTimelineFlags_SortedKeyframes))
+                ImGui::EndNeoTimeLine();
+        }
+        ImGui::EndNeoSequencer();
+    }
+
+    style.VertexBudget = budget;
+}
+
+// Keyframes right of lane are neither drawn nor counted into vertex share
+inline void NeoTestSceneOffscreenKeys()
+{
+    using namespace NeoTestData;
+    auto& style = ImGui::GetNeoSequencerStyle();
+    const uint32_t budget = style.VertexBudget;
+    style.VertexBudget = 20000;
+
+    if (ImGui::BeginNeoSequencer("OffscreenKeys", &currentFrame, &startFrame, &endFrame, sequencerSize))
+    {
+        if (ImGui::BeginNeoTimeline("Offscreen", offscreenTrack))
+            ImGui::EndNeoTimeLine();
+        ImGui::EndNeoSequencer();
+    }
+
+    style.VertexBudget = budget;
+}
+
+inline void NeoTestSceneCurve()
+{
+    using namespace NeoTestData;
+    if (ImGui::BeginNeoSequencer("Curve", &currentFrame, &startFrame, &endFrame, sequencerSize))
+    {
+        ImGui::NeoTimelineCurve("Curve", curve.data(), (int) curve.size(), -1.0f, 1.0f);
+        ImGui::EndNeoSequencer();
+    }
+}
+
+inline void NeoTestSceneZones()
+{
+    using namespace NeoTestData;
+    if (ImGui::BeginNeoSequencer("Zones", &currentFrame, &startFrame, &endFrame, sequencerSize))
+    {
+        if (ImGui::BeginNeoTimelineEx("Zones"))
+        {
+            ImGui::NeoActiveZones("Zones", zones.data(), (uint32_t) zones.size(), ImGuiNeoActiveZonesFlags_Stack);
+            ImGui::EndNeoTimeLine();
+        }
+        ImGui::EndNeoSequencer();
+    }
+}
+
+static const NeoTestScene neoTestScenes[] = {
+        {"empty",           NeoTestSceneEmpty},
+        {"keyframes",       NeoTestSceneKeyframes},
+        {"vertex_budget",   NeoTestSceneVertexBudget},
+        {"offscreen_keys",  NeoTestSceneOffscreenKeys},
+        {"curve",           NeoTestSceneCurve},
+        {"zones",           NeoTestSceneZones},
+};
+
+// Scripted mouse interaction repeating every interactionCycleFrames frames: box selection, dragging selection
+// right and back, with minimap and provided lane. Output changes every frame, so it is not a draw budget scene.
+namespace NeoTestData
+{
+    static const int interactionCycleFrames = 24;
+    static const float interactionDragPixels = 30.0f;
+
+    static ImGui::FrameIndexType interactionFrame = 0;
+    static std::vector<int32_t> interactionTracks[3]; // Keyframe every 5 frames, denser than keyframe size
+    static std::vector<int32_t> interactionBulkTrack;
+    static ImGuiNeoLaneProvider* interactionProvider = nullptr;
+
+    struct NeoTestInteraction
+    {
+        int Frame = 0; // Frame of cycle
+        ImVec2 Min = {0, 0}; // Sequencer rect of last frame
+        ImVec2 Max = {0, 0};
+        ImVec2 Grab = {0, 0}; // Point over selected keyframe, found by probing once
+        bool HasGrab = false;
+        float ProbeY = 0.0f;
+        bool HoveredSelected = false; // Mouse is over selected keyframe this frame
+    };
+    static NeoTestInteraction interaction;
+
+    // Keyframe every 25 frames of window
+    static bool fetchInteractionLane(void*, ImGuiID, ImGui::FrameIndexType from, ImGui::FrameIndexType to,
+                                     std::vector<ImGui::FrameIndexType>& keyframes)
+    {
+        for (ImGui::FrameIndexType frame = (from + 24) / 25 * 25; frame < to; frame += 25)
+            keyframes.push_back(frame);
+        return true;
+    }
+}
+
+inline void NeoTestSetupInteraction()
+{
+    using namespace NeoTestData;
+
+    for (auto& track: interactionTracks)
+    {
+        track.clear();
+        for (int32_t i = 0; i < 200; i++)
+            track.push_back(i * 5);
+    }
+
+    interactionBulkTrack.clear();
+    for (int32_t i = 0; i < 200; i++)
+        interactionBulkTrack.push_back(i * 5 + 2);
+
+    interaction = NeoTestInteraction();
+    interactionProvider = ImGui::NeoCreateLaneProvider(fetchInteractionLane, nullptr, 1 << 20, 256);
+}
+
+inline void NeoTestTeardownInteraction()
+{
+    ImGui::NeoDestroyLaneProvider(NeoTestData::interactionProvider);
+    NeoTestData::interactionProvider = nullptr;
+}
+
+// Queues mouse state for next frame
+inline void NeoTestMouse(const ImVec2& pos, bool down)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.AddMousePosEvent(pos.x, pos.y);
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, down);
+}
+
+inline void NeoTestSceneInteraction()
+{
+    using namespace NeoTestData;
+    auto& state = interaction;
+    state.HoveredSelected = false;
+
+    const ImGuiNeoSequencerFlags flags = ImGuiNeoSequencerFlags_EnableSelection |
+                                         ImGuiNeoSequencerFlags_Selection_EnableDragging |
+                                         ImGuiNeoSequencerFlags_ZoomBarMinimap;
+    if (ImGui::BeginNeoSequencer("Interaction", &interactionFrame, &startFrame, &endFrame, sequencerSize, flags))
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            if (ImGui::BeginNeoTimelineEx(trackLabels[i]))
+            {
+                for (auto& frame: interactionTracks[i])
+                {
+                    ImGui::NeoKeyframe(&frame);
+                    if (ImGui::IsNeoKeyframeHovered() && ImGui::IsNeoKeyframeSelected())
+                        state.HoveredSelected = true;
+                }
+                ImGui::EndNeoTimeLine();
+            }
+        }
+        if (ImGui::BeginNeoTimeline(trackLabels[3], interactionBulkTrack))
+            ImGui::EndNeoTimeLine();
+        if (ImGui::BeginNeoTimelineProvided(trackLabels[4], interactionProvider, 1))
+            ImGui::EndNeoTimeLine();
+        ImGui::EndNeoSequencer();
+
+        state.Min = ImGui::GetItemRectMin();
+        state.Max = ImGui::GetItemRectMax();
+    }
+
+    const ImVec2 size = state.Max - state.Min;
+
+    // Box selection starts in empty area below lanes and goes up over them
+    const ImVec2 boxStart = state.Max - ImVec2(20.0f, 20.0f);
+    const ImVec2 boxEnd = state.Min + ImVec2(size.x * 0.4f, 0.0f);
+
+    if (state.Frame < 6)
+    {
+        const float t = (float) state.Frame / 5.0f;
+        NeoTestMouse(boxStart + (boxEnd - boxStart) * t, state.Frame < 5);
+        state.Frame++;
+        return;
+    }
+
+    // Once per run, walks down lanes until selected keyframe is under mouse
+    if (!state.HasGrab)
+    {
+        if (state.HoveredSelected)
+        {
+            state.HasGrab = true;
+            state.Grab = ImVec2(state.Min.x + size.x * 0.7f, state.ProbeY);
+        }
+        else
+        {
+            state.ProbeY = state.ProbeY < state.Min.y ? state.Min.y : state.ProbeY + 2.0f;
+            if (state.ProbeY > state.Max.y)
+                state.ProbeY = state.Min.y;
+            NeoTestMouse(ImVec2(state.Min.x + size.x * 0.7f, state.ProbeY), false);
+            return;
+        }
+    }
+
+    const ImVec2 dragged = state.Grab + ImVec2(interactionDragPixels, 0.0f);
+    const int f = state.Frame;
+    if (f == 6)
+        NeoTestMouse(state.Grab, false);
+    else if (f < 12) // Drag right
+        NeoTestMouse(state.Grab + (dragged - state.Grab) * ((float) (f - 7) / 4.0f), true);
+    else if (f < 14)
+        NeoTestMouse(dragged, false);
+    else if (f < 19) // Drag back
+        NeoTestMouse(dragged + (state.Grab - dragged) * ((float) (f - 14) / 4.0f), true);
+    else
+        NeoTestMouse(state.Grab, false);
+
+    state.Frame = (state.Frame + 1) % interactionCycleFrames;
+}
+
+#endif //IMGUI_NEO_TEST_SUPPORT_H
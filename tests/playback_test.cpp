@@ -0,0 +1,125 @@
+//
+// Playback engine driven by injected clock
+//
+
+#include "neo_test_support.h"
+
+static int64_t testClock = 0; // Nanoseconds
+
+static int64_t readTestClock(void*)
+{
+    return testClock;
+}
+
+static void advanceSeconds(double seconds)
+{
+    testClock += (int64_t) (seconds * 1e9);
+}
+
+// 10 frames per second over frames [0, 9], playing from frame
+static ImGuiNeoPlayback startPlayback(ImGui::FrameIndexType* frame, ImGui::FrameIndexType from)
+{
+    ImGuiNeoPlayback playback;
+    playback.FrameRate = 10.0;
+    playback.Clock = readTestClock;
+    testClock = 1000000000;
+
+    *frame = from;
+    ImGui::NeoPlaybackUpdate(&playback, frame, 0, 9);
+    ImGui::NeoPlaybackPlay(&playback);
+    return playback;
+}
+
+static void testLoopWrap()
+{
+    ImGui::FrameIndexType frame = 0;
+    auto playback = startPlayback(&frame, 0);
+
+    advanceSeconds(0.55);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 5);
+
+    // 12.5 frames played, range is 10 frames long
+    advanceSeconds(0.70);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 2);
+    NEO_CHECK(playback.Playing);
+}
+
+static void testStopAtEnd()
+{
+    ImGui::FrameIndexType frame = 0;
+    auto playback = startPlayback(&frame, 0);
+    playback.Loop = false;
+
+    advanceSeconds(2.05);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 9);
+    NEO_CHECK(!playback.Playing);
+
+    // Stays at end
+    advanceSeconds(1.0);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 9);
+}
+
+static void testNegativeRate()
+{
+    ImGui::FrameIndexType frame = 0;
+    auto playback = startPlayback(&frame, 5);
+    playback.Rate = -1.0;
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+
+    advanceSeconds(0.25);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 2);
+
+    // Position -3.5 wraps to 6.5
+    advanceSeconds(0.60);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 6);
+
+    playback.Loop = false;
+    advanceSeconds(1.0);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 9);
+    NEO_CHECK(frame == 0);
+    NEO_CHECK(!playback.Playing);
+}
+
+static void testRateChange()
+{
+    ImGui::FrameIndexType frame = 0;
+    auto playback = startPlayback(&frame, 0);
+
+    advanceSeconds(0.35);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 99);
+    NEO_CHECK(frame == 3);
+
+    // Frames played so far keep old speed, playhead doesn't jump
+    playback.Rate = 2.0;
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 99);
+    NEO_CHECK(frame == 3);
+
+    advanceSeconds(1.0);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 99);
+    NEO_CHECK(frame == 23);
+
+    playback.FrameRate = 5.0;
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 99);
+    NEO_CHECK(frame == 23);
+
+    advanceSeconds(1.0);
+    ImGui::NeoPlaybackUpdate(&playback, &frame, 0, 99);
+    NEO_CHECK(frame == 33);
+}
+
+int main()
+{
+    testLoopWrap();
+    testStopAtEnd();
+    testNegativeRate();
+    testRateChange();
+
+    printf("%s playback_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}
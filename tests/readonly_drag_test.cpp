@@ -0,0 +1,117 @@
+//
+// Dragging selection over struct range timelines, const range keeps its frames
+//
+
+#include "neo_test_support.h"
+
+struct NeoTestKey
+{
+    float Value; // Frame isn't first member, so stride is exercised
+    int32_t Frame;
+};
+
+static std::vector<int32_t> probeKeys; // Per key lane used to find selected keyframe under mouse
+static std::vector<NeoTestKey> editableKeys;
+static std::vector<NeoTestKey> readOnlyKeys;
+
+static ImGui::FrameIndexType currentFrame = 0;
+static ImGui::FrameIndexType startFrame = 0;
+static ImGui::FrameIndexType endFrame = 1000;
+
+static ImVec2 sequencerMin, sequencerMax;
+static bool hoveredSelected = false;
+
+static void drawScene()
+{
+    hoveredSelected = false;
+    const ImGuiNeoSequencerFlags flags = ImGuiNeoSequencerFlags_EnableSelection |
+                                         ImGuiNeoSequencerFlags_Selection_EnableDragging;
+    if (ImGui::BeginNeoSequencer("ReadOnlyDrag", &currentFrame, &startFrame, &endFrame, NeoTestData::sequencerSize, flags))
+    {
+        if (ImGui::BeginNeoTimelineEx("Probe"))
+        {
+            for (auto& frame: probeKeys)
+            {
+                ImGui::NeoKeyframe(&frame);
+                if (ImGui::IsNeoKeyframeHovered() && ImGui::IsNeoKeyframeSelected())
+                    hoveredSelected = true;
+            }
+            ImGui::EndNeoTimeLine();
+        }
+        if (ImGui::BeginNeoTimeline("Editable", editableKeys, &NeoTestKey::Frame))
+            ImGui::EndNeoTimeLine();
+
+        const std::vector<NeoTestKey>& constKeys = readOnlyKeys;
+        if (ImGui::BeginNeoTimeline("ReadOnly", constKeys, &NeoTestKey::Frame))
+            ImGui::EndNeoTimeLine();
+
+        ImGui::EndNeoSequencer();
+        sequencerMin = ImGui::GetItemRectMin();
+        sequencerMax = ImGui::GetItemRectMax();
+    }
+}
+
+int main()
+{
+    for (int32_t i = 0; i < 50; i++)
+    {
+        probeKeys.push_back(i * 20);
+        editableKeys.push_back({(float) i, i * 20});
+        readOnlyKeys.push_back({(float) i, i * 20});
+    }
+
+    NeoTestContext context;
+    context.Frame(drawScene);
+
+    // Box selection from empty area below lanes up over right part of them
+    const ImVec2 size = sequencerMax - sequencerMin;
+    const ImVec2 boxStart = sequencerMax - ImVec2(20.0f, 20.0f);
+    const ImVec2 boxEnd = sequencerMin + ImVec2(size.x * 0.4f, 0.0f);
+    for (int f = 0; f < 6; f++)
+    {
+        NeoTestMouse(boxStart + (boxEnd - boxStart) * ((float) f / 5.0f), f < 5);
+        context.Frame(drawScene);
+    }
+
+    // Walks down until selected keyframe of probe lane is under mouse
+    const float grabX = sequencerMin.x + size.x * 0.7f;
+    float grabY = sequencerMin.y;
+    for (; grabY <= sequencerMax.y; grabY += 2.0f)
+    {
+        NeoTestMouse(ImVec2(grabX, grabY), false);
+        context.Frame(drawScene);
+        if (hoveredSelected)
+            break;
+    }
+    NEO_CHECK(hoveredSelected);
+
+    // Drag right, all selected keyframes follow
+    const ImVec2 grab = {grabX, grabY};
+    NeoTestMouse(grab, false);
+    context.Frame(drawScene);
+    for (int f = 0; f <= 4; f++)
+    {
+        NeoTestMouse(grab + ImVec2(40.0f * (float) f / 4.0f, 0.0f), true);
+        context.Frame(drawScene);
+    }
+    NeoTestMouse(grab + ImVec2(40.0f, 0.0f), false);
+    context.Frame(drawScene);
+    context.Frame(drawScene);
+
+    int moved = 0, editableMismatches = 0, readOnlyMoved = 0;
+    for (int32_t i = 0; i < 50; i++)
+    {
+        if (probeKeys[i] != i * 20)
+            moved++;
+        if (editableKeys[i].Frame != probeKeys[i] || editableKeys[i].Value != (float) i)
+            editableMismatches++;
+        if (readOnlyKeys[i].Frame != i * 20 || readOnlyKeys[i].Value != (float) i)
+            readOnlyMoved++;
+    }
+    NEO_CHECK(moved > 0);
+    NEO_CHECK(editableMismatches == 0);
+    NEO_CHECK(readOnlyMoved == 0);
+
+    printf("%s readonly_drag_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+//
+// Predicted view range while zoom slider is dragged at constant rate
+//
+
+#include "neo_test_support.h"
+
+static const float secondsAhead = 0.25f;
+static const float dragPixelsPerFrame = 4.0f;
+
+static ImGui::FrameIndexType currentFrame = 0;
+static ImGui::FrameIndexType startFrame = 0;
+static ImGui::FrameIndexType endFrame = 1000;
+
+static ImVec2 sequencerMin, sequencerMax;
+static ImGui::NeoFrameRange view, predicted;
+
+static void drawScene()
+{
+    if (ImGui::BeginNeoSequencer("Prediction", &currentFrame, &startFrame, &endFrame, NeoTestData::sequencerSize))
+    {
+        view = ImGui::NeoGetViewRange();
+        predicted = ImGui::NeoGetPredictedViewRange(secondsAhead);
+        ImGui::EndNeoSequencer();
+        sequencerMin = ImGui::GetItemRectMin();
+        sequencerMax = ImGui::GetItemRectMax();
+    }
+}
+
+// Prediction never leaves sequence
+static bool clamped()
+{
+    return predicted.from >= startFrame && predicted.to <= endFrame + 1 && predicted.from <= predicted.to;
+}
+
+int main()
+{
+    NeoTestContext context;
+    ImGuiIO& io = ImGui::GetIO();
+    context.Frame(drawScene);
+
+    // Zoom bar is at top of sequencer, zoom in by mouse wheel over it
+    const float barY = sequencerMin.y + ImGui::GetFontSize() / 2.0f + ImGui::GetStyle().FramePadding.y;
+    const float barWidth = sequencerMax.x - sequencerMin.x;
+    ImVec2 mouse = {sequencerMin.x + barWidth * 0.1f, barY};
+    for (int i = 0; i < 3; i++)
+    {
+        NeoTestMouse(mouse, false);
+        io.AddMouseWheelEvent(0.0f, 1.0f);
+        context.Frame(drawScene);
+    }
+    for (int i = 0; i < 30; i++)
+        context.Frame(drawScene);
+
+    const int viewWidth = view.to - view.from;
+    NEO_CHECK(viewWidth < (endFrame - startFrame) / 2);
+    NEO_CHECK(predicted.from == view.from);
+
+    // Drag slider right at constant rate until view hits end of sequence
+    NeoTestMouse(mouse, true);
+    context.Frame(drawScene);
+
+    const ImGui::NeoFrameRange dragStart = view;
+    ImGui::NeoFrameRange steadyStart = view;
+    int steadyFrames = 0, leadingFrames = 0, unclampedFrames = 0, endFrames = 0;
+    for (int f = 0; mouse.x < sequencerMax.x + 80.0f; f++)
+    {
+        mouse.x += dragPixelsPerFrame;
+        NeoTestMouse(mouse, true);
+        context.Frame(drawScene);
+
+        if (!clamped())
+            unclampedFrames++;
+
+        // Pan velocity is smoothed, lead is checked once it settled and while prediction can't reach end
+        if (f == 20)
+            steadyStart = view;
+        if (f > 20 && view.to + viewWidth < endFrame)
+        {
+            steadyFrames++;
+            const float framesPerSecond = (float) (view.from - steadyStart.from) / (float) steadyFrames * 60.0f;
+            const float expectedLead = framesPerSecond * secondsAhead;
+            const float lead = (float) (predicted.from - view.from);
+            if (lead > expectedLead * 0.5f && lead < expectedLead * 1.5f + 2.0f)
+                leadingFrames++;
+        }
+
+        // Still moving view stopped by end of sequence, prediction is held there
+        if (view.to >= endFrame)
+        {
+            endFrames++;
+            if (predicted.from < view.from)
+                unclampedFrames++;
+        }
+    }
+    NEO_CHECK(view.from > dragStart.from);
+    NEO_CHECK(steadyFrames > 20);
+    NEO_CHECK(leadingFrames == steadyFrames);
+    NEO_CHECK(endFrames > 10);
+    NEO_CHECK(unclampedFrames == 0);
+
+    // Settles to view once it stops moving
+    NeoTestMouse(mouse, false);
+    for (int i = 0; i < 120; i++)
+        context.Frame(drawScene);
+    NEO_CHECK(predicted.from == view.from && predicted.to - view.to <= 1 && view.to - predicted.to <= 1);
+    NEO_CHECK(clamped());
+
+    printf("%s view_prediction_test\n", neoTestFailures == 0 ? "OK" : "FAIL");
+    return neoTestFailures == 0 ? 0 : 1;
+}